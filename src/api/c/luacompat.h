@@ -0,0 +1,33 @@
+#ifndef MODSERVER_LUACOMPAT_H
+#define MODSERVER_LUACOMPAT_H
+
+/*
+The server is built against the bundled Lua 5.2 or, with make LUA=luajit, against LuaJIT 
+2.1. LuaJIT has the C API of Lua 5.1 plus some functions from 5.2. This header defines the 
+rest of the 5.2 API used by the server and its modules.
+*/
+
+#include <stdio.h>
+#include <lauxlib.h>
+#include <lua.h>
+#include <lualib.h>
+
+#if LUA_VERSION_NUM == 501
+
+#define LUA_OK 0
+
+#define lua_rawlen(l, index) lua_objlen(l, index)
+
+#ifndef luaL_newlib
+#define luaL_newlib(l, funcs) (lua_newtable(l), luaL_setfuncs(l, funcs, 0))
+#endif
+
+// A LuaJIT file handle also starts with the FILE pointer.
+typedef struct luaL_Stream
+{
+  FILE *f;
+} luaL_Stream;
+
+#endif
+
+#endif
@@ -1,5 +1,6 @@
 // C99
 #include <assert.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,6 +8,8 @@
 #include <lauxlib.h>
 #include <lua.h>
 #include <lualib.h>
+#include "luacompat.h"
+#include "native.h"
 
 /*
 Users of the API must not have to manage or be aware of the Lua stack. This API 
@@ -49,6 +52,27 @@ const char *get_header(lua_State *l, const char *name)
   return arg;
 }
 
+size_t get_headers(lua_State *l, const char **headers, size_t max)
+{
+  lua_getfield(l, -1, "request");
+  lua_getfield(l, -1, "headers");
+  size_t count = 0;
+  lua_pushnil(l);
+  while (lua_next(l, -2) != 0)
+  {
+    if (count < max)
+    {
+      // The strings stay referenced by the headers table.
+      headers[count * 2] = lua_tostring(l, -2);
+      headers[count * 2 + 1] = lua_tostring(l, -1);
+    }
+    ++count;
+    lua_pop(l, 1);
+  }
+  lua_pop(l, 2);
+  return count;
+}
+
 void set_header(lua_State *l, const char *name, const char *value)
 {
   lua_getfield(l, -1, "set_header");
@@ -91,90 +115,61 @@ size_t rwrite(lua_State *l, const char *buffer, size_t length)
   return 0;
 }
 
-static int write_status_line_and_headers(lua_State *l)
+size_t rwritev(lua_State *l, const struct iovec *iov, int count)
 {
-  lua_getfield(l, -1, "write_status_line_and_headers");
-  lua_pushvalue(l, 1);
-  if (lua_pcall(l, 1, LUA_MULTRET, 0) != LUA_OK)
-  {
-    lua_pop(l, 3);
-    return -1;
-  }
-  return 0;
+  return native_writev(native_v1_servlet(l), iov, count);
 }
 
-static FILE* get_clientfd_write(lua_State *l)
+int rprintf(lua_State *l, const char *format, ...)
 {
-  lua_getfield(l, -1, "clientfd_write");
-  luaL_Stream *stream = luaL_checkudata(l, -1, LUA_FILEHANDLE);
-  FILE *file = stream->f;
-  lua_pop(l, 1);
-  return file;
+  va_list ap;
+  va_start(ap, format);
+  int ret = native_vprintf(native_v1_servlet(l), format, ap);
+  va_end(ap);
+  return ret;
 }
 
-int rprintf(lua_State *l, const char *format, ...)
+void rflush(lua_State *l)
 {
-  lua_getfield(l, -1, "response_headers_written");
-  int response_headers_written = lua_toboolean(l, -1);
-  lua_pop(l, 1);
-  if (!response_headers_written)
-  {
-    if (write_status_line_and_headers(l) != 0)
-    {
-      return -1;
-    }
-  }
-  FILE *file = get_clientfd_write(l);
-  int ret;
-  va_list ap0, ap1;
-  va_start(ap0, format);
-  va_copy(ap1, ap0);
-  // Get the length of the output without writing anything.
-  // Per C99: "If n is zero, nothing is written, and s may be a null pointer."
-  int len = vsnprintf(NULL, 0, format, ap0);
-  va_end(ap0);
-  if (!len)
-  {
-    return -1;
-  }
-  if (strcmp(get_method(l), "HEAD") == 0)
-  {
-    return len;
-  }
-  lua_getfield(l, -1, "response_headers");
-  lua_getfield(l, -1, "content-length");
-  int chunked = !lua_toboolean(l, -1);
-  lua_pop(l, 2);
-  if (chunked)
-  {
-    ret = fprintf(file, "%X\r\n", len);
-    if (!ret)
-    {
-      va_end(ap1);
-      return -1;
-    }
-  }
-  ret = vfprintf(file, format, ap1);
-  if (!ret)
+  lua_getfield(l, -1, "rflush");
+  lua_pushvalue(l, 1);
+  lua_call(l, 1, 0);
+}
+
+int sse_send(lua_State *l, const char *event, const char *data)
+{
+  lua_getfield(l, -1, "sse_send");
+  lua_pushvalue(l, 1);
+  // lua_pushstring() pushes nil for NULL.
+  lua_pushstring(l, event);
+  lua_pushstring(l, data);
+  if (lua_pcall(l, 3, 1, 0) != LUA_OK)
   {
-    va_end(ap1);
+    lua_pop(l, 1);
     return -1;
   }
-  va_end(ap1);
-  if (chunked)
-  {
-    ret = fprintf(file, "\r\n");
-    if (!ret)
-    {
-      return -1;
-    }
-  }
-  return ret;
+  int ok = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  return ok ? 0 : -1;
 }
 
-void rflush(lua_State *l)
+void sse_subscribe(lua_State *l, const char *channel)
 {
-  lua_getfield(l, -1, "rflush");
+  lua_getfield(l, -1, "sse_subscribe");
   lua_pushvalue(l, 1);
-  lua_call(l, 1, 0);
+  lua_pushstring(l, channel);
+  lua_call(l, 2, 0);
+}
+
+int sse_publish(lua_State *l, const char *channel, const char *event, const char *data)
+{
+  lua_getfield(l, -1, "sse_publish");
+  lua_pushvalue(l, 1);
+  lua_pushstring(l, channel);
+  lua_pushstring(l, event);
+  lua_pushstring(l, data);
+  lua_call(l, 4, 1);
+  int ok = !lua_isnil(l, -1);
+  lua_pop(l, 1);
+  return ok ? 0 : -1;
 }
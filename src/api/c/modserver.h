@@ -1,7 +1,9 @@
 #ifndef MODSERVER_H
 #define MODSERVER_H
 
+#include <stdarg.h>
 #include <stddef.h>
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +52,26 @@ assert(strcmp(val0, val1) == 0);
 */
 const char* get_header(servlet *s, const char *name);
 
+/*
+Store the names and values of up to max request headers in headers, which must have room 
+for 2 * max pointers, as name, value pairs. Return the number of request headers, which 
+may be more than max. Names are lowercase.
+
+This gets all the headers in one call, which matters to languages where each call into C 
+has a cost.
+
+The returned strings are NULL terminated. The application must not free them.
+
+// Example:
+const char *headers[2 * 32];
+size_t count = get_headers(s, headers, 32);
+for (size_t i = 0; i < count && i < 32; ++i)
+{
+  rprintf(s, "%s: %s\n", headers[i * 2], headers[i * 2 + 1]);
+}
+*/
+size_t get_headers(servlet *s, const char **headers, size_t max);
+
 /*
 Set the HTTP response status code.
 
@@ -100,6 +122,26 @@ rwrite(s, reply, sizeof(reply) - 1);
 */
 size_t rwrite(servlet *s, const char *buffer, size_t length);
 
+/*
+Write the count buffers of iov to the output stream as if they were one buffer, and return 
+their total length. A response made of many small fragments, such as the output of a 
+template, can be written with one call instead of one call per fragment. Large writes are 
+passed to writev() without being copied into the output stream.
+
+See the documentation of rwrite() for the behavior of rwritev() with regard to the output 
+stream.
+
+// Example:
+const char *name = "world";
+struct iovec iov[] = {
+  {.iov_base = "hello ", .iov_len = 6},
+  {.iov_base = (void*)name, .iov_len = strlen(name)},
+  {.iov_base = "\n", .iov_len = 1},
+};
+rwritev(s, iov, 3);
+*/
+size_t rwritev(servlet *s, const struct iovec *iov, int count);
+
 /*
 Write to the output stream according to the given printf format string and arguments.
 
@@ -133,6 +175,247 @@ rprintf(s, "done\n");
 */
 void rflush(servlet *s);
 
+/*
+Send a Server-Sent Event: a text/event-stream response that the browser reads with 
+EventSource. The event name may be NULL. Each line of data becomes a data field. The event 
+is written as one chunk and flushed at once. Return 0 on success or -1 if the client is 
+gone.
+
+// Example:
+sse_send(s, "price", "42");
+*/
+int sse_send(servlet *s, const char *event, const char *data);
+
+/*
+Turn the response into an event stream that receives every message published to the 
+named broadcast channel, which is declared with the broadcast_channel directive. The 
+stream is kept open by the server after run() returns, so one process serves any number 
+of subscribers.
+*/
+void sse_subscribe(servlet *s, const char *channel);
+
+/*
+Publish an event to the subscribers of the broadcast channel in every process. Return 0 
+on success or -1 if the channel does not exist or the event is too large for it.
+*/
+int sse_publish(servlet *s, const char *channel, const char *event, const char *data);
+
+/*
+ABI version 2
+
+By default the servlet pointer is a handle into the server's Lua state and each API 
+function above works through it. A servlet built for version 2 defines MODSERVER_ABI as 2 
+before including this header and defines modserver_init(). The server then calls the 
+servlet's functions directly from C with a servlet whose api field points at a table of 
+the API functions. The functions above become inline calls through that table, so no Lua 
+is involved in an API call.
+
+The server calls these functions of a version 2 servlet:
+  int modserver_init(const modserver_api *api) once when the servlet is loaded, before 
+    any request. Return 0 on success. Any other value fails loading the servlet.
+  int init(servlet *s) the first time the servlet is requested in a process. Optional.
+  int run(servlet *s) for each request.
+  void cleanup(void) before the process exits or the servlet is reloaded. Optional.
+
+A version 2 servlet is unloaded with dlclose() when it is reloaded, so it must not leave 
+threads running or callbacks registered. The int cleanup(servlet *s) function of a version 
+1 servlet is also called, like its run(), but version 1 servlets are never unloaded.
+
+// Example:
+#define MODSERVER_ABI 2
+#include "modserver.h"
+
+int modserver_init(const modserver_api *api)
+{
+  return api->version >= 2 ? 0 : -1;
+}
+
+int run(servlet *s)
+{
+  rprintf(s, "method: %s\n", get_method(s));
+  return 0;
+}
+*/
+#define MODSERVER_ABI_VERSION 3
+
+/*
+Deferred requests (ABI version 2 only)
+
+A servlet waiting on something slow, such as a backend or a long-poll notification, 
+should not hold the whole process while it waits. defer() detaches the request and returns 
+a servlet that stays valid until the response is finished. The process goes back to 
+accepting connections after run() returns, and calls the callback given to one of the 
+resume functions later from its event loop. The callback writes to the deferred servlet 
+as run() would and calls finish() to end the response, or registers another callback to 
+keep waiting. The resume functions defer the request if run() has not.
+
+Only write to a deferred servlet from its own callbacks. Another request handled by the 
+same process wakes it with resume(). Requests still open after the deferred_timeout 
+directive are finished by the server.
+
+The functions of this section, and sse_subscribe() and the ws_ functions in version 2, 
+return 0 on success or -1 if the server could not do it, such as for a bad fd or a request 
+that has ended. The error is printed by the server. defer() returns NULL then.
+
+on_finish() (API version 3) sets a function that the server calls with the deferred 
+servlet and data once the request has ended, whether a callback called finish(), the 
+deferred_timeout directive expired, or the client went away. Free what the callbacks use 
+there and do not call other API functions. The deferred servlet is invalid after the 
+function returns, so a servlet that keeps it where other requests can reach it must forget 
+it there. If the request has already ended, on_finish() calls the function at once.
+
+// Example:
+static void done(servlet *s, void *data)
+{
+  rprintf(s, "waited %d ms\n", *(int*)data);
+  finish(s);
+}
+
+int run(servlet *s)
+{
+  static int delay = 1000;
+  servlet *s2 = defer(s);
+  resume_after(s2, delay, done, &delay);
+  return 0;
+}
+*/
+typedef void (*modserver_callback)(servlet *s, void *data);
+
+/*
+sse_start() (ABI version 2 only) defers the request like defer() and turns the response 
+into an event stream that is not limited by deferred_timeout. The server sends heartbeats 
+to the stream and finishes it when the client is gone. Send events from callbacks with 
+sse_send().
+*/
+/*
+WebSocket connections (ABI version 2 only)
+
+ws_upgrade() answers a WebSocket handshake with 101 Switching Protocols and returns a 
+deferred servlet for the connection, or NULL after writing an error response if the 
+request is not a valid handshake. The process keeps the connection open in its event loop 
+after run() returns, so one process serves any number of idle connections. Use the 
+returned servlet with the other ws_ functions, also from the callbacks of other requests 
+handled by the same process.
+
+ws_on_message() sets the callback called for each whole message. Inside it ws_recv() 
+returns the message, which stays valid until the callback returns, and sets *length and 
+*binary if they are not NULL. The callback is called once more when the connection closes, 
+with ws_recv() returning NULL. ws_send() sends a text or binary message and returns 0 on 
+success or -1 if the client is gone. ws_close() sends a close frame with the status code, 
+or none if it is 0, and closes the connection.
+
+Messages larger than the websocket_max_message directive close the connection. The server 
+pings each connection every websocket_ping seconds and closes the ones that do not answer.
+
+// Example:
+static void echo(servlet *s, void *data)
+{
+  size_t length;
+  int binary;
+  const char *message = ws_recv(s, &length, &binary);
+  if (message)
+  {
+    ws_send(s, message, length, binary);
+  }
+}
+
+int run(servlet *s)
+{
+  servlet *ws = ws_upgrade(s);
+  if (ws)
+  {
+    ws_on_message(ws, echo, NULL);
+  }
+  return 0;
+}
+*/
+/*
+Functions are only ever added to the end of this table. The version field tells which 
+ones the server provides.
+*/
+typedef struct modserver_api
+{
+  int version;
+  const char* (*get_arg)(servlet *s, const char *name);
+  const char* (*get_method)(servlet *s);
+  const char* (*get_header)(servlet *s, const char *name);
+  void (*set_status)(servlet *s, int status);
+  void (*set_header)(servlet *s, const char *name, const char *value);
+  size_t (*rwrite)(servlet *s, const char *buffer, size_t length);
+  int (*rvprintf)(servlet *s, const char *format, va_list ap);
+  void (*rflush)(servlet *s);
+  size_t (*get_headers)(servlet *s, const char **headers, size_t max);
+  size_t (*rwritev)(servlet *s, const struct iovec *iov, int count);
+  servlet* (*defer)(servlet *s);
+  int (*resume_on_readable)(servlet *s, int fd, modserver_callback callback, void *data);
+  int (*resume_after)(servlet *s, int milliseconds, modserver_callback callback,
+    void *data);
+  int (*resume)(servlet *s, modserver_callback callback, void *data);
+  int (*finish)(servlet *s);
+  int (*sse_send)(servlet *s, const char *event, const char *data);
+  int (*sse_subscribe)(servlet *s, const char *channel);
+  int (*sse_publish)(servlet *s, const char *channel, const char *event, const char *data);
+  servlet* (*sse_start)(servlet *s);
+  servlet* (*ws_upgrade)(servlet *s);
+  int (*ws_on_message)(servlet *s, modserver_callback callback, void *data);
+  const char* (*ws_recv)(servlet *s, size_t *length, int *binary);
+  int (*ws_send)(servlet *s, const char *message, size_t length, int binary);
+  int (*ws_close)(servlet *s, int code, const char *reason);
+  // Version 3
+  void (*on_finish)(servlet *s, modserver_callback callback, void *data);
+} modserver_api;
+
+#if defined(MODSERVER_ABI) && MODSERVER_ABI >= 2
+
+struct servlet
+{
+  const modserver_api *api;
+};
+
+int modserver_init(const modserver_api *api);
+
+static inline int modserver_rprintf(servlet *s, const char *format, ...)
+{
+  va_list ap;
+  va_start(ap, format);
+  int ret = s->api->rvprintf(s, format, ap);
+  va_end(ap);
+  return ret;
+}
+
+#define get_arg(s, name) ((s)->api->get_arg((s), (name)))
+#define get_method(s) ((s)->api->get_method(s))
+#define get_header(s, name) ((s)->api->get_header((s), (name)))
+#define get_headers(s, headers, max) ((s)->api->get_headers((s), (headers), (max)))
+#define set_status(s, status) ((s)->api->set_status((s), (status)))
+#define set_header(s, name, value) ((s)->api->set_header((s), (name), (value)))
+#define rwrite(s, buffer, length) ((s)->api->rwrite((s), (buffer), (length)))
+#define rwritev(s, iov, count) ((s)->api->rwritev((s), (iov), (count)))
+#define rprintf modserver_rprintf
+#define rflush(s) ((s)->api->rflush(s))
+#define defer(s) ((s)->api->defer(s))
+#define resume_on_readable(s, fd, callback, data) \
+  ((s)->api->resume_on_readable((s), (fd), (callback), (data)))
+#define resume_after(s, milliseconds, callback, data) \
+  ((s)->api->resume_after((s), (milliseconds), (callback), (data)))
+#define resume(s, callback, data) ((s)->api->resume((s), (callback), (data)))
+#define finish(s) ((s)->api->finish(s))
+#define sse_send(s, event, data) ((s)->api->sse_send((s), (event), (data)))
+#define sse_subscribe(s, channel) ((s)->api->sse_subscribe((s), (channel)))
+#define sse_publish(s, channel, event, data) \
+  ((s)->api->sse_publish((s), (channel), (event), (data)))
+#define sse_start(s) ((s)->api->sse_start(s))
+#define ws_upgrade(s) ((s)->api->ws_upgrade(s))
+#define ws_on_message(s, callback, data) \
+  ((s)->api->ws_on_message((s), (callback), (data)))
+#define ws_recv(s, length, binary) ((s)->api->ws_recv((s), (length), (binary)))
+#define ws_send(s, message, length, binary) \
+  ((s)->api->ws_send((s), (message), (length), (binary)))
+#define ws_close(s, code, reason) ((s)->api->ws_close((s), (code), (reason)))
+#define on_finish(s, callback, data) ((s)->api->on_finish((s), (callback), (data)))
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1242 @@
+// fileno() is part of POSIX and is hidden by -std=c99 on glibc.
+#define _POSIX_C_SOURCE 200112L
+// C99
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+// POSIX
+#include <dlfcn.h>
+#include <strings.h>
+#include <sys/uio.h>
+#include <unistd.h>
+// Lua
+#include <lauxlib.h>
+#include <lua.h>
+#include <lualib.h>
+#include "luacompat.h"
+
+#define MODSERVER_ABI 2
+#include "modserver.h"
+#include "native.h"
+
+/*
+Shared object servlets. The server loads them with dlopen() and binds their functions
+directly instead of through package.loadlib().
+
+A version 2 servlet gets a native_servlet for each call. The API functions in the table
+work on the servlet state table that handle_request() in modserver.lua passes to run(),
+but access its fields directly instead of calling the Lua API functions.
+*/
+
+#define LIBRARY "modserver.native.library"
+/*
+A weak table from each deferred_request to its servlet state table. A deferred request may 
+be resumed or finished while another request is at index 1 of the stack.
+*/
+#define DEFERRED "modserver.native.deferred"
+// The userdata in the state table that points to the deferred_request of the request.
+#define DEFERRED_REQUEST "modserver.native.deferred_request"
+
+/*
+The request fields that the API functions read, collected once when the request starts. The 
+strings stay referenced by the request table and the arrays by the state table, so both 
+live as long as the request.
+*/
+typedef struct request_fields
+{
+  const char *method;
+  // Name and value pairs. Header names are lowercase.
+  const char **headers;
+  size_t header_count;
+  const char **args;
+  size_t arg_count;
+} request_fields;
+
+struct native_servlet
+{
+  struct servlet base;
+  // The servlet state table is at index 1 of the stack.
+  lua_State *l;
+  request_fields request;
+  FILE *out;
+  // The framing of the response body: 'c'hunked, 'i'dentity, 'n'one for HEAD, or 0 when
+  // the headers have not been written.
+  char body;
+  int error;
+  /*
+  The request that defer() detached during this call of init() or run(). In the servlet 
+  that defer() returns, the request it belongs to.
+  */
+  struct deferred_request *deferred;
+};
+
+/*
+A deferred request, allocated by defer() and owned by the server. The servlet that defer() 
+returns is its first member. The server holds one reference while the request is open and 
+one for each call of the servlet that runs with it, so finish() called from a callback does 
+not free the servlet that the callback still holds. Once finished, the API functions ignore 
+the request, and the servlet must not use it after its on_finish() callback returns.
+*/
+typedef struct deferred_request
+{
+  native_servlet ns;
+  int refs;
+  int finished;
+  modserver_callback finish_callback;
+  void *finish_data;
+} deferred_request;
+
+/*
+Store the string keys and values of the table at the top of the stack in pairs, or only 
+count them if pairs is NULL. Other entries are left out.
+*/
+static size_t get_string_pairs(lua_State *l, const char **pairs)
+{
+  size_t count = 0;
+  lua_pushnil(l);
+  while (lua_next(l, -2) != 0)
+  {
+    if (lua_type(l, -2) == LUA_TSTRING && lua_type(l, -1) == LUA_TSTRING)
+    {
+      if (pairs)
+      {
+        pairs[count * 2] = lua_tostring(l, -2);
+        pairs[count * 2 + 1] = lua_tostring(l, -1);
+      }
+      ++count;
+    }
+    lua_pop(l, 1);
+  }
+  return count;
+}
+
+/*
+Set the request fields of ns from the request table. They are kept in the state table as 
+native_request, so init() and run() of the same request share them.
+*/
+static void get_request_fields(native_servlet *ns)
+{
+  lua_State *l = ns->l;
+  lua_getfield(l, 1, "native_request");
+  request_fields *fields = lua_touserdata(l, -1);
+  lua_pop(l, 1);
+  if (fields)
+  {
+    ns->request = *fields;
+    return;
+  }
+  lua_getfield(l, 1, "request");
+  if (!lua_istable(l, -1))
+  {
+    lua_pop(l, 1);
+    return;
+  }
+  int request = lua_gettop(l);
+  lua_getfield(l, request, "headers");
+  size_t header_count = lua_istable(l, -1) ? get_string_pairs(l, NULL) : 0;
+  lua_getfield(l, request, "query");
+  size_t arg_count = lua_istable(l, -1) ? get_string_pairs(l, NULL) : 0;
+  fields = lua_newuserdata(l,
+    sizeof(request_fields) + sizeof(const char*) * 2 * (header_count + arg_count));
+  lua_setfield(l, 1, "native_request");
+  fields->headers = (const char**)(fields + 1);
+  fields->args = fields->headers + header_count * 2;
+  fields->header_count = 0;
+  fields->arg_count = 0;
+  if (arg_count)
+  {
+    fields->arg_count = get_string_pairs(l, fields->args);
+  }
+  lua_pop(l, 1);
+  if (header_count)
+  {
+    fields->header_count = get_string_pairs(l, fields->headers);
+  }
+  lua_pop(l, 1);
+  lua_getfield(l, request, "method");
+  fields->method = lua_tostring(l, -1);
+  lua_pop(l, 2);
+  ns->request = *fields;
+}
+
+static const char* find_pair(const char **pairs, size_t count, const char *name,
+  int (*compare)(const char *a, const char *b))
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (compare(pairs[i * 2], name) == 0)
+    {
+      return pairs[i * 2 + 1];
+    }
+  }
+  return NULL;
+}
+
+static const char* native_get_arg(servlet *s, const char *name)
+{
+  native_servlet *ns = (native_servlet*)s;
+  return find_pair(ns->request.args, ns->request.arg_count, name, strcmp);
+}
+
+static const char* native_get_method(servlet *s)
+{
+  native_servlet *ns = (native_servlet*)s;
+  return ns->request.method;
+}
+
+static const char* native_get_header(servlet *s, const char *name)
+{
+  native_servlet *ns = (native_servlet*)s;
+  return find_pair(ns->request.headers, ns->request.header_count, name, strcasecmp);
+}
+
+static size_t native_get_headers(servlet *s, const char **headers, size_t max)
+{
+  native_servlet *ns = (native_servlet*)s;
+  size_t count = ns->request.header_count;
+  size_t copied = count < max ? count : max;
+  if (copied)
+  {
+    memcpy(headers, ns->request.headers, sizeof(const char*) * 2 * copied);
+  }
+  return count;
+}
+
+static void native_set_status(servlet *s, int status)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_pushinteger(ns->l, status);
+  lua_setfield(ns->l, 1, "status");
+}
+
+// Push the lowercase copy of name.
+static void push_lower(lua_State *l, const char *name)
+{
+  luaL_Buffer b;
+  luaL_buffinit(l, &b);
+  for (const char *p = name; *p; ++p)
+  {
+    char c = *p;
+    luaL_addchar(&b, c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+  }
+  luaL_pushresult(&b);
+}
+
+// The same as api:set_header() in api/lua/modserver.lua.
+static void native_set_header(servlet *s, const char *name, const char *value)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_State *l = ns->l;
+  lua_getfield(l, 1, "response_headers");
+  push_lower(l, name);
+  lua_createtable(l, 0, 2);
+  lua_pushstring(l, name);
+  lua_setfield(l, -2, "name");
+  lua_pushstring(l, value);
+  lua_setfield(l, -2, "value");
+  lua_rawset(l, -3);
+  lua_pop(l, 1);
+}
+
+static void set_error(native_servlet *ns, const char *message)
+{
+  ns->error = 1;
+  lua_pushstring(ns->l, message);
+  lua_setfield(ns->l, 1, "response_error");
+}
+
+/*
+Write the status line and headers the first time the servlet writes. The framing of the
+body that write_status_line_and_headers() chose is read once here.
+*/
+static int write_headers(native_servlet *ns)
+{
+  lua_State *l = ns->l;
+  lua_getfield(l, 1, "response_headers_written");
+  int written = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  if (!written)
+  {
+    lua_getfield(l, 1, "write_status_line_and_headers");
+    lua_pushvalue(l, 1);
+    if (lua_pcall(l, 1, 0, 0) != LUA_OK)
+    {
+      set_error(ns, lua_tostring(l, -1));
+      lua_pop(l, 1);
+      return 0;
+    }
+  }
+  lua_getfield(l, 1, "response_body");
+  const char *body = lua_tostring(l, -1);
+  ns->body = body ? body[0] : 'c';
+  lua_pop(l, 1);
+  lua_getfield(l, 1, "clientfd_write");
+  luaL_Stream *stream = luaL_testudata(l, -1, LUA_FILEHANDLE);
+  ns->out = stream ? stream->f : NULL;
+  lua_pop(l, 1);
+  if (!ns->out)
+  {
+    set_error(ns, "the response has no output stream");
+    return 0;
+  }
+  return 1;
+}
+
+/*
+Bodies at least this large bypass the stream buffer and go to the socket with one writev().
+*/
+#define WRITEV_MIN_SIZE 16384
+// The number of buffers writev() is given at most, including the chunk framing.
+#define WRITEV_MAX_COUNT 64
+
+static int writev_all(int fd, struct iovec *iov, int count)
+{
+  while (count > 0)
+  {
+    ssize_t written = writev(fd, iov, count);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return 0;
+    }
+    // Skip past the buffers that were written completely.
+    while (count > 0 && (size_t)written >= iov->iov_len)
+    {
+      written -= iov->iov_len;
+      ++iov;
+      --count;
+    }
+    if (count > 0)
+    {
+      iov->iov_base = (char*)iov->iov_base + written;
+      iov->iov_len -= written;
+    }
+  }
+  return 1;
+}
+
+static int send_deferred(native_servlet *ns, const char *size, size_t size_length,
+  const struct iovec *iov, int count);
+
+static ssize_t write_body(native_servlet *ns, const struct iovec *iov, int count)
+{
+  FILE *out = ns->out;
+  char body = ns->body;
+  size_t total = 0;
+  for (int i = 0; i < count; ++i)
+  {
+    total += iov[i].iov_len;
+  }
+  if (body == 'n' || total == 0)
+  {
+    // A zero length chunk would end the response.
+    return total;
+  }
+  char size[24];
+  int size_length = 0;
+  if (body == 'c')
+  {
+    size_length = snprintf(size, sizeof(size), "%zX\r\n", total);
+  }
+  if (ns->deferred)
+  {
+    return send_deferred(ns, size, size_length, iov, count) ? (ssize_t)total : -1;
+  }
+  // A TLS stream in user space has no descriptor to write to.
+  if (total >= WRITEV_MIN_SIZE && count + 2 <= WRITEV_MAX_COUNT && fileno(out) >= 0)
+  {
+    struct iovec all[WRITEV_MAX_COUNT];
+    int n = 0;
+    if (size_length)
+    {
+      all[n++] = (struct iovec){.iov_base = size, .iov_len = size_length};
+    }
+    for (int i = 0; i < count; ++i)
+    {
+      if (iov[i].iov_len)
+      {
+        all[n++] = iov[i];
+      }
+    }
+    if (size_length)
+    {
+      all[n++] = (struct iovec){.iov_base = "\r\n", .iov_len = 2};
+    }
+    // Write what is already buffered first to keep the order.
+    if (fflush(out) != 0 || !writev_all(fileno(out), all, n))
+    {
+      return -1;
+    }
+    return total;
+  }
+  if (size_length && fwrite(size, 1, size_length, out) != (size_t)size_length)
+  {
+    return -1;
+  }
+  for (int i = 0; i < count; ++i)
+  {
+    if (fwrite(iov[i].iov_base, 1, iov[i].iov_len, out) != iov[i].iov_len)
+    {
+      return -1;
+    }
+  }
+  if (size_length && fwrite("\r\n", 1, 2, out) != 2)
+  {
+    return -1;
+  }
+  return total;
+}
+
+size_t native_writev(native_servlet *ns, const struct iovec *iov, int count)
+{
+  if (ns->error || (!ns->body && !write_headers(ns)))
+  {
+    return 0;
+  }
+  ssize_t written = write_body(ns, iov, count);
+  if (written < 0)
+  {
+    if (!ns->error)
+    {
+      set_error(ns, strerror(errno));
+    }
+    return 0;
+  }
+  return written;
+}
+
+/*
+Room in front of the formatted output for the chunk size of a 64-bit length and CRLF.
+*/
+#define CHUNK_PREFIX_SIZE 18
+// Output that fits in this buffer along with its chunk framing is not copied to the heap.
+#define PRINTF_BUFFER_SIZE 4096
+
+/*
+Format the output once, after space reserved for the chunk size, and then write the chunk 
+size in front of it and CRLF behind it so that the whole chunk goes to the stream with one 
+fwrite(). Only output too large for the stack buffer is formatted a second time, into a 
+buffer of the right size.
+*/
+int native_vprintf(native_servlet *ns, const char *format, va_list ap)
+{
+  if (ns->error || (!ns->body && !write_headers(ns)))
+  {
+    return -1;
+  }
+  char stack_buffer[PRINTF_BUFFER_SIZE];
+  char *buffer = stack_buffer;
+  va_list ap_copy;
+  va_copy(ap_copy, ap);
+  // Leave room behind the output for CRLF, which replaces the NUL.
+  int len = vsnprintf(buffer + CHUNK_PREFIX_SIZE,
+    sizeof(stack_buffer) - CHUNK_PREFIX_SIZE - 1, format, ap);
+  if (len >= 0 && (size_t)len >= sizeof(stack_buffer) - CHUNK_PREFIX_SIZE - 1)
+  {
+    buffer = malloc(CHUNK_PREFIX_SIZE + len + 2);
+    if (!buffer)
+    {
+      va_end(ap_copy);
+      return -1;
+    }
+    vsnprintf(buffer + CHUNK_PREFIX_SIZE, len + 1, format, ap_copy);
+  }
+  va_end(ap_copy);
+  if (len <= 0 || ns->body == 'n')
+  {
+    if (buffer != stack_buffer)
+    {
+      free(buffer);
+    }
+    // A zero length chunk would end the response.
+    return len;
+  }
+  char *start = buffer + CHUNK_PREFIX_SIZE;
+  size_t size = len;
+  if (ns->body == 'c')
+  {
+    char prefix[CHUNK_PREFIX_SIZE + 1];
+    int prefix_length = snprintf(prefix, sizeof(prefix), "%X\r\n", (unsigned)len);
+    start -= prefix_length;
+    memcpy(start, prefix, prefix_length);
+    memcpy(start + prefix_length + len, "\r\n", 2);
+    size += prefix_length + 2;
+  }
+  int ok;
+  if (ns->deferred)
+  {
+    struct iovec iov = {.iov_base = start, .iov_len = size};
+    ok = send_deferred(ns, NULL, 0, &iov, 1);
+  }
+  else
+  {
+    ok = fwrite(start, 1, size, ns->out) == size;
+    if (!ok)
+    {
+      set_error(ns, strerror(errno));
+    }
+  }
+  if (buffer != stack_buffer)
+  {
+    free(buffer);
+  }
+  return ok ? len : -1;
+}
+
+static size_t native_rwritev(servlet *s, const struct iovec *iov, int count)
+{
+  return native_writev((native_servlet*)s, iov, count);
+}
+
+static size_t native_rwrite(servlet *s, const char *buffer, size_t length)
+{
+  struct iovec iov = {.iov_base = (void*)buffer, .iov_len = length};
+  return native_writev((native_servlet*)s, &iov, 1);
+}
+
+static int native_rvprintf(servlet *s, const char *format, va_list ap)
+{
+  return native_vprintf((native_servlet*)s, format, ap);
+}
+
+static void native_rflush(servlet *s)
+{
+  native_servlet *ns = (native_servlet*)s;
+  if (!ns->body)
+  {
+    write_headers(ns);
+  }
+  if (ns->out)
+  {
+    fflush(ns->out);
+  }
+}
+
+typedef struct callback
+{
+  modserver_callback function;
+  void *data;
+} callback;
+
+/*
+Call the function below nargs arguments with lua_pcall(). A Lua error must not unwind 
+through the frames of the servlet, which may not be C, or past release_request() in 
+call_servlet(). The error is printed and 0 returned.
+*/
+static int protected_call(lua_State *l, int nargs, int nresults)
+{
+  if (lua_pcall(l, nargs, nresults, 0) != LUA_OK)
+  {
+    fprintf(stderr, "%s\n", lua_tostring(l, -1));
+    lua_pop(l, 1);
+    return 0;
+  }
+  return 1;
+}
+
+static void release_request(deferred_request *request)
+{
+  if (--request->refs == 0)
+  {
+    free(request);
+  }
+}
+
+/*
+End the deferred request that anchor points to, if it has not ended, and call its 
+on_finish() callback. Later writes are dropped because the connection is closed.
+*/
+static void end_request(lua_State *l, deferred_request **anchor)
+{
+  deferred_request *request = *anchor;
+  if (!request)
+  {
+    return;
+  }
+  *anchor = NULL;
+  request->finished = 1;
+  request->ns.error = 1;
+  request->ns.l = l;
+  lua_getfield(l, LUA_REGISTRYINDEX, DEFERRED);
+  lua_pushlightuserdata(l, request);
+  lua_pushnil(l);
+  lua_rawset(l, -3);
+  lua_pop(l, 1);
+  if (request->finish_callback)
+  {
+    request->finish_callback(&request->ns.base, request->finish_data);
+  }
+  release_request(request);
+}
+
+/*
+state:on_finish(), called by event.finish() once the connection of a deferred request is 
+closed.
+*/
+static int finish_deferred(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TTABLE);
+  lua_settop(l, 1);
+  lua_getfield(l, 1, "native_servlet");
+  deferred_request **anchor = luaL_checkudata(l, -1, DEFERRED_REQUEST);
+  end_request(l, anchor);
+  return 0;
+}
+
+/*
+The state table of a request that the server dropped without finishing it, such as after 
+run() raised an error, ends the request when it is collected.
+*/
+static int collect_deferred(lua_State *l)
+{
+  end_request(l, luaL_checkudata(l, 1, DEFERRED_REQUEST));
+  return 0;
+}
+
+/*
+Call the callback of a deferred request with the state table at index 1, as run() is 
+called.
+*/
+static int call_callback(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TTABLE);
+  lua_settop(l, 1);
+  callback *cb = lua_touserdata(l, lua_upvalueindex(1));
+  lua_getfield(l, 1, "native_servlet");
+  deferred_request **anchor = luaL_testudata(l, -1, DEFERRED_REQUEST);
+  lua_pop(l, 1);
+  deferred_request *request = anchor ? *anchor : NULL;
+  if (!request)
+  {
+    return 0;
+  }
+  ++request->refs;
+  request->ns.l = l;
+  cb->function(&request->ns.base, cb->data);
+  release_request(request);
+  return 0;
+}
+
+/*
+defer_request(ns, state) detaches the request of the native_servlet ns, whose state table 
+is state. Called by native_defer() with lua_pcall().
+*/
+static int defer_request(lua_State *l)
+{
+  native_servlet *ns = lua_touserdata(l, 1);
+  lua_settop(l, 2);
+  lua_remove(l, 1);
+  lua_getfield(l, 1, "defer");
+  lua_pushvalue(l, 1);
+  lua_call(l, 1, 0);
+  // The state table keeps the anchor for as long as the request.
+  deferred_request **anchor = lua_newuserdata(l, sizeof(deferred_request*));
+  *anchor = NULL;
+  luaL_setmetatable(l, DEFERRED_REQUEST);
+  deferred_request *request = malloc(sizeof(deferred_request));
+  if (!request)
+  {
+    return luaL_error(l, "not enough memory");
+  }
+  // One reference for the request and one for the call of the servlet that deferred it.
+  *request = (deferred_request){.ns = *ns, .refs = 2};
+  request->ns.deferred = request;
+  *anchor = request;
+  lua_setfield(l, 1, "native_servlet");
+  lua_pushcfunction(l, finish_deferred);
+  lua_setfield(l, 1, "on_finish");
+  lua_getfield(l, LUA_REGISTRYINDEX, DEFERRED);
+  lua_pushlightuserdata(l, request);
+  lua_pushvalue(l, 1);
+  lua_rawset(l, -3);
+  lua_pop(l, 1);
+  ns->deferred = request;
+  return 0;
+}
+
+static servlet* native_defer(servlet *s)
+{
+  native_servlet *ns = (native_servlet*)s;
+  if (!ns->deferred)
+  {
+    lua_State *l = ns->l;
+    lua_pushcfunction(l, defer_request);
+    lua_pushlightuserdata(l, ns);
+    lua_pushvalue(l, 1);
+    if (!protected_call(l, 2, 0))
+    {
+      return NULL;
+    }
+  }
+  return &ns->deferred->ns.base;
+}
+
+/*
+Push the method of the deferred request of s with the given name and its state table, and 
+return the Lua state to call it in with protected_call(). Return NULL and push nothing if s 
+is NULL, was not deferred, or its request has ended. The servlet is not used again after 
+this returns, since the call may end the request.
+*/
+static lua_State* push_deferred_method(servlet *s, const char *name)
+{
+  deferred_request *request = s ? ((native_servlet*)s)->deferred : NULL;
+  if (!request || request->finished)
+  {
+    return NULL;
+  }
+  lua_State *l = request->ns.l;
+  lua_getfield(l, LUA_REGISTRYINDEX, DEFERRED);
+  lua_pushlightuserdata(l, request);
+  lua_rawget(l, -2);
+  lua_remove(l, -2);
+  if (lua_isnil(l, -1))
+  {
+    lua_pop(l, 1);
+    return NULL;
+  }
+  lua_getfield(l, -1, name);
+  lua_insert(l, -2);
+  return l;
+}
+
+/*
+Write the output of a deferred request, framed by the chunk size if size_length is not 0, 
+through api:send_deferred(), which queues what a slow client does not take instead of 
+blocking the child. A failed write is remembered in response_error by the event loop.
+*/
+static int send_deferred(native_servlet *ns, const char *size, size_t size_length,
+  const struct iovec *iov, int count)
+{
+  lua_State *l = push_deferred_method(&ns->base, "send_deferred");
+  int ok = 0;
+  if (l)
+  {
+    luaL_Buffer b;
+    luaL_buffinit(l, &b);
+    if (size_length)
+    {
+      luaL_addlstring(&b, size, size_length);
+    }
+    for (int i = 0; i < count; ++i)
+    {
+      luaL_addlstring(&b, iov[i].iov_base, iov[i].iov_len);
+    }
+    if (size_length)
+    {
+      luaL_addlstring(&b, "\r\n", 2);
+    }
+    luaL_pushresult(&b);
+    if (protected_call(l, 2, 1))
+    {
+      ok = lua_toboolean(l, -1);
+      lua_pop(l, 1);
+    }
+  }
+  ns->error = !ok;
+  return ok;
+}
+
+static void push_callback(lua_State *l, modserver_callback function, void *data)
+{
+  callback *cb = lua_newuserdata(l, sizeof(callback));
+  cb->function = function;
+  cb->data = data;
+  lua_pushcclosure(l, call_callback, 1);
+}
+
+static int native_resume_on_readable(servlet *s, int fd, modserver_callback function,
+  void *data)
+{
+  lua_State *l = push_deferred_method(native_defer(s), "resume_on_readable");
+  if (!l)
+  {
+    return -1;
+  }
+  lua_pushinteger(l, fd);
+  push_callback(l, function, data);
+  return protected_call(l, 3, 0) ? 0 : -1;
+}
+
+static int native_resume_after(servlet *s, int milliseconds, modserver_callback function,
+  void *data)
+{
+  lua_State *l = push_deferred_method(native_defer(s), "resume_after");
+  if (!l)
+  {
+    return -1;
+  }
+  lua_pushinteger(l, milliseconds);
+  push_callback(l, function, data);
+  return protected_call(l, 3, 0) ? 0 : -1;
+}
+
+static int native_resume(servlet *s, modserver_callback function, void *data)
+{
+  lua_State *l = push_deferred_method(native_defer(s), "resume");
+  if (!l)
+  {
+    return -1;
+  }
+  push_callback(l, function, data);
+  return protected_call(l, 2, 0) ? 0 : -1;
+}
+
+static int native_finish(servlet *s)
+{
+  lua_State *l = push_deferred_method(s, "finish");
+  if (!l)
+  {
+    return -1;
+  }
+  return protected_call(l, 1, 0) ? 0 : -1;
+}
+
+/*
+A request that has already ended, or could not be deferred, calls the function at once, 
+so that what data points to is freed either way.
+*/
+static void native_on_finish(servlet *s, modserver_callback function, void *data)
+{
+  native_servlet *ns = (native_servlet*)native_defer(s);
+  deferred_request *request = ns ? ns->deferred : NULL;
+  if (!request || request->finished)
+  {
+    function(request ? &request->ns.base : s, data);
+    return;
+  }
+  request->finish_callback = function;
+  request->finish_data = data;
+}
+
+static int native_sse_send(servlet *s, const char *event, const char *data)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_State *l = ns->l;
+  lua_getfield(l, 1, "sse_send");
+  lua_pushvalue(l, 1);
+  lua_pushstring(l, event);
+  lua_pushstring(l, data);
+  if (!protected_call(l, 3, 1))
+  {
+    return -1;
+  }
+  int ok = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  return ok ? 0 : -1;
+}
+
+static int native_sse_subscribe(servlet *s, const char *channel)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_getfield(ns->l, 1, "sse_subscribe");
+  lua_pushvalue(ns->l, 1);
+  lua_pushstring(ns->l, channel);
+  return protected_call(ns->l, 2, 0) ? 0 : -1;
+}
+
+static int native_sse_publish(servlet *s, const char *channel, const char *event,
+  const char *data)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_State *l = ns->l;
+  lua_getfield(l, 1, "sse_publish");
+  lua_pushvalue(l, 1);
+  lua_pushstring(l, channel);
+  lua_pushstring(l, event);
+  lua_pushstring(l, data);
+  if (!protected_call(l, 4, 1))
+  {
+    return -1;
+  }
+  int ok = !lua_isnil(l, -1);
+  lua_pop(l, 1);
+  return ok ? 0 : -1;
+}
+
+// A stream that could not start is finished, since it has no deferred_timeout.
+static servlet* native_sse_start(servlet *s)
+{
+  servlet *deferred = native_defer(s);
+  lua_State *l = push_deferred_method(deferred, "sse_start");
+  if (!l)
+  {
+    return NULL;
+  }
+  if (!protected_call(l, 1, 0))
+  {
+    native_finish(deferred);
+    return NULL;
+  }
+  return deferred;
+}
+
+static servlet* native_ws_upgrade(servlet *s)
+{
+  native_servlet *ns = (native_servlet*)s;
+  lua_getfield(ns->l, 1, "ws_upgrade");
+  lua_pushvalue(ns->l, 1);
+  if (!protected_call(ns->l, 1, 1))
+  {
+    return NULL;
+  }
+  int ok = !lua_isnil(ns->l, -1);
+  lua_pop(ns->l, 1);
+  return ok ? native_defer(s) : NULL;
+}
+
+static int native_ws_on_message(servlet *s, modserver_callback function, void *data)
+{
+  lua_State *l = push_deferred_method(s, "ws_on_message");
+  if (!l)
+  {
+    return -1;
+  }
+  push_callback(l, function, data);
+  return protected_call(l, 2, 0) ? 0 : -1;
+}
+
+/*
+The message stays referenced by the state table until the callback returns, so the 
+pointer into it stays valid until then.
+*/
+static const char* native_ws_recv(servlet *s, size_t *length, int *binary)
+{
+  const char *message = NULL;
+  size_t size = 0;
+  int kind = 0;
+  lua_State *l = push_deferred_method(s, "ws_recv");
+  if (l && protected_call(l, 1, 2))
+  {
+    message = lua_tolstring(l, -2, &size);
+    const char *kind_name = lua_tostring(l, -1);
+    kind = kind_name && strcmp(kind_name, "binary") == 0;
+    lua_pop(l, 2);
+  }
+  if (length)
+  {
+    *length = size;
+  }
+  if (binary)
+  {
+    *binary = kind;
+  }
+  return message;
+}
+
+static int native_ws_send(servlet *s, const char *message, size_t length, int binary)
+{
+  lua_State *l = push_deferred_method(s, "ws_send");
+  if (!l)
+  {
+    return -1;
+  }
+  lua_pushlstring(l, message, length);
+  lua_pushstring(l, binary ? "binary" : "text");
+  if (!protected_call(l, 3, 1))
+  {
+    return -1;
+  }
+  int ok = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  return ok ? 0 : -1;
+}
+
+static int native_ws_close(servlet *s, int code, const char *reason)
+{
+  lua_State *l = push_deferred_method(s, "ws_close");
+  if (!l)
+  {
+    return -1;
+  }
+  if (code)
+  {
+    lua_pushinteger(l, code);
+  }
+  else
+  {
+    lua_pushnil(l);
+  }
+  lua_pushstring(l, reason);
+  return protected_call(l, 3, 0) ? 0 : -1;
+}
+
+static const modserver_api native_api =
+{
+  .version = MODSERVER_ABI_VERSION,
+  .get_arg = native_get_arg,
+  .get_method = native_get_method,
+  .get_header = native_get_header,
+  .set_status = native_set_status,
+  .set_header = native_set_header,
+  .rwrite = native_rwrite,
+  .rvprintf = native_rvprintf,
+  .rflush = native_rflush,
+  .get_headers = native_get_headers,
+  .rwritev = native_rwritev,
+  .defer = native_defer,
+  .resume_on_readable = native_resume_on_readable,
+  .resume_after = native_resume_after,
+  .resume = native_resume,
+  .finish = native_finish,
+  .sse_send = native_sse_send,
+  .sse_subscribe = native_sse_subscribe,
+  .sse_publish = native_sse_publish,
+  .sse_start = native_sse_start,
+  .ws_upgrade = native_ws_upgrade,
+  .ws_on_message = native_ws_on_message,
+  .ws_recv = native_ws_recv,
+  .ws_send = native_ws_send,
+  .ws_close = native_ws_close,
+  .on_finish = native_on_finish,
+};
+
+typedef struct library
+{
+  void *handle;
+  int abi;
+  int (*init)(servlet *s);
+  int (*run)(servlet *s);
+  // void cleanup(void), or int cleanup(servlet *s) as a lua_CFunction in version 1.
+  void (*cleanup)(void);
+} library;
+
+static library* check_library(lua_State *l, int index)
+{
+  library *lib = luaL_checkudata(l, index, LIBRARY);
+  if (!lib->handle)
+  {
+    luaL_error(l, "the servlet library was unloaded");
+  }
+  return lib;
+}
+
+/*
+native.load(path) returns the library and its ABI version, or nil and an error message.
+*/
+static int native_load(lua_State *l)
+{
+  const char *path = luaL_checkstring(l, 1);
+  library *lib = lua_newuserdata(l, sizeof(library));
+  memset(lib, 0, sizeof(library));
+  luaL_setmetatable(l, LIBRARY);
+  lib->handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (!lib->handle)
+  {
+    lua_pushnil(l);
+    lua_pushstring(l, dlerror());
+    return 2;
+  }
+  // Converting a void* to a function pointer is allowed by POSIX for dlsym().
+  *(void**)&lib->init = dlsym(lib->handle, "init");
+  *(void**)&lib->run = dlsym(lib->handle, "run");
+  *(void**)&lib->cleanup = dlsym(lib->handle, "cleanup");
+  int (*modserver_init)(const modserver_api *api);
+  *(void**)&modserver_init = dlsym(lib->handle, "modserver_init");
+  lib->abi = modserver_init ? 2 : 1;
+  const char *errmsg = NULL;
+  if (!lib->run)
+  {
+    errmsg = "the servlet must have a run() function";
+  }
+  else if (modserver_init && modserver_init(&native_api) != 0)
+  {
+    errmsg = "modserver_init() failed";
+  }
+  if (errmsg)
+  {
+    dlclose(lib->handle);
+    lib->handle = NULL;
+    lua_pushnil(l);
+    lua_pushfstring(l, "%s: %s", path, errmsg);
+    return 2;
+  }
+  lua_pushinteger(l, lib->abi);
+  return 2;
+}
+
+static int call_servlet(lua_State *l, int (*function)(servlet *s))
+{
+  luaL_checktype(l, 1, LUA_TTABLE);
+  lua_settop(l, 1);
+  native_servlet ns = {.base = {.api = &native_api}, .l = l};
+  get_request_fields(&ns);
+  int status = function(&ns.base);
+  if (ns.deferred)
+  {
+    release_request(ns.deferred);
+  }
+  lua_pushinteger(l, status);
+  return 1;
+}
+
+/*
+The response state of the version 1 servlet that is running. The version 1 API functions 
+receive only the lua_State, so the state for the call to init() or run() lives here.
+*/
+static native_servlet v1_servlet;
+// Fresh state for each API call made outside of a version 1 servlet.
+static native_servlet other_servlet;
+
+native_servlet* native_v1_servlet(lua_State *l)
+{
+  if (v1_servlet.l == l)
+  {
+    return &v1_servlet;
+  }
+  other_servlet = (native_servlet){.base = {.api = &native_api}, .l = l};
+  return &other_servlet;
+}
+
+/*
+Call a version 1 function, which is a Lua C function, with v1_servlet set for the duration 
+of the call. The call is protected so that v1_servlet is reset when it raises an error.
+*/
+static int call_v1_servlet(lua_State *l, lua_CFunction function)
+{
+  native_servlet previous = v1_servlet;
+  v1_servlet = (native_servlet){.base = {.api = &native_api}, .l = l};
+  lua_pushcfunction(l, function);
+  lua_insert(l, 1);
+  int status = lua_pcall(l, lua_gettop(l) - 1, LUA_MULTRET, 0);
+  v1_servlet = previous;
+  if (status != LUA_OK)
+  {
+    return lua_error(l);
+  }
+  return lua_gettop(l);
+}
+
+static int bound_v1_init(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  return call_v1_servlet(l, (lua_CFunction)lib->init);
+}
+
+static int bound_v1_run(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  return call_v1_servlet(l, (lua_CFunction)lib->run);
+}
+
+static int bound_init(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  return call_servlet(l, lib->init);
+}
+
+static int bound_run(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  return call_servlet(l, lib->run);
+}
+
+static int bound_v1_cleanup(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  return call_v1_servlet(l, (lua_CFunction)lib->cleanup);
+}
+
+static int bound_cleanup(lua_State *l)
+{
+  library *lib = check_library(l, lua_upvalueindex(1));
+  lib->cleanup();
+  return 0;
+}
+
+/*
+native.bind(library, name) returns a Lua function that calls init, run, or cleanup of the
+servlet, or nil if the servlet does not define it. The init and run functions of a version
+1 servlet are Lua C functions themselves and are called with the servlet state table as 
+they are. Its cleanup function is called the same way, with the servlet table.
+*/
+static int native_bind(lua_State *l)
+{
+  library *lib = check_library(l, 1);
+  const char *name = luaL_checkstring(l, 2);
+  int (*function)(servlet *s);
+  lua_CFunction bound;
+  if (strcmp(name, "init") == 0)
+  {
+    function = lib->init;
+    bound = lib->abi == 1 ? bound_v1_init : bound_init;
+  }
+  else if (strcmp(name, "run") == 0)
+  {
+    function = lib->run;
+    bound = lib->abi == 1 ? bound_v1_run : bound_run;
+  }
+  else if (strcmp(name, "cleanup") == 0)
+  {
+    if (lib->cleanup)
+    {
+      lua_pushvalue(l, 1);
+      lua_pushcclosure(l, lib->abi == 1 ? bound_v1_cleanup : bound_cleanup, 1);
+    }
+    else
+    {
+      lua_pushnil(l);
+    }
+    return 1;
+  }
+  else
+  {
+    return luaL_argerror(l, 2, "must be init, run, or cleanup");
+  }
+  if (!function)
+  {
+    lua_pushnil(l);
+  }
+  else
+  {
+    lua_pushvalue(l, 1);
+    lua_pushcclosure(l, bound, 1);
+  }
+  return 1;
+}
+
+/*
+native.unload(library) closes the library. Functions bound to it raise an error afterward.
+*/
+static int native_unload(lua_State *l)
+{
+  library *lib = luaL_checkudata(l, 1, LIBRARY);
+  if (lib->handle)
+  {
+    dlclose(lib->handle);
+    lib->handle = NULL;
+  }
+  return 0;
+}
+
+static const luaL_Reg native[] =
+{
+  {"load", native_load},
+  {"bind", native_bind},
+  {"unload", native_unload},
+  {NULL, NULL},
+};
+
+LUALIB_API int luaopen_native(lua_State *l)
+{
+  // Libraries are not closed when collected. Version 1 servlets may not be safe to unload.
+  luaL_newmetatable(l, LIBRARY);
+  lua_pop(l, 1);
+  luaL_newmetatable(l, DEFERRED_REQUEST);
+  lua_pushcfunction(l, collect_deferred);
+  lua_setfield(l, -2, "__gc");
+  lua_pop(l, 1);
+  // The state tables of finished requests are collected.
+  lua_newtable(l);
+  lua_newtable(l);
+  lua_pushliteral(l, "v");
+  lua_setfield(l, -2, "__mode");
+  lua_setmetatable(l, -2);
+  lua_setfield(l, LUA_REGISTRYINDEX, DEFERRED);
+  luaL_newlib(l, native);
+  return 1;
+}
@@ -0,0 +1,30 @@
+#ifndef MODSERVER_NATIVE_H
+#define MODSERVER_NATIVE_H
+
+/*
+Response body output shared by both versions of the C API. This header is internal to the 
+server.
+*/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <sys/uio.h>
+#include <lua.h>
+
+typedef struct native_servlet native_servlet;
+
+/*
+Return the response state of the version 1 servlet running in l. It caches the output 
+stream and the framing of the body so that each write does not look them up in the 
+servlet state table. Outside of a version 1 servlet, such as when a language module calls 
+the API, it returns fresh state that looks them up again.
+*/
+native_servlet* native_v1_servlet(lua_State *l);
+
+/*
+The implementations of rwritev() and rprintf() for both versions of the C API.
+*/
+size_t native_writev(native_servlet *ns, const struct iovec *iov, int count);
+int native_vprintf(native_servlet *ns, const char *format, va_list ap);
+
+#endif
@@ -8,35 +8,67 @@ package api
 */
 import "C"
 
-import "unsafe"
+import (
+  "errors"
+  "runtime"
+  "unsafe"
+)
 
 //type Servlet C.servlet
 //type Servlet unsafe.Pointer
 
-func to_ptr(str string) (unsafe.Pointer) {
-  str_slice := []byte(str)
-  str_ptr := unsafe.Pointer(&str_slice[0])
-  return str_ptr
+// Return a NUL terminated copy of the string for C.
+func to_cstring(str string) ([]byte) {
+  cstr := make([]byte, len(str) + 1)
+  copy(cstr, str)
+  return cstr
+}
+
+// Point into the bytes of a string without copying them. C must not write to them.
+func string_data(str string) (*C.char) {
+  return (*C.char)(unsafe.Pointer(unsafe.StringData(str)))
 }
 
 func Get_arg(s unsafe.Pointer, name string) (string) {
-  name_ptr := to_ptr(name)
-  arg := C.get_arg((*C.servlet)(s), (*C.char)(name_ptr))
-  arg_string := C.GoString(arg)
-  return arg_string
+  name_cstr := to_cstring(name)
+  arg := C.get_arg((*C.servlet)(s), (*C.char)(unsafe.Pointer(&name_cstr[0])))
+  runtime.KeepAlive(name_cstr)
+  return C.GoString(arg)
 }
 
 func Get_method(s unsafe.Pointer) (string) {
   method := C.get_method((*C.servlet)(s))
-  method_string := C.GoString(method)
-  return method_string
+  return C.GoString(method)
 }
 
 func Get_header(s unsafe.Pointer, name string) (string) {
-  name_ptr := to_ptr(name)
-  value := C.get_header((*C.servlet)(s), (*C.char)(name_ptr))
-  value_string := C.GoString(value)
-  return value_string
+  name_cstr := to_cstring(name)
+  value := C.get_header((*C.servlet)(s), (*C.char)(unsafe.Pointer(&name_cstr[0])))
+  runtime.KeepAlive(name_cstr)
+  return C.GoString(value)
+}
+
+// The number of headers Get_headers asks for in its first call.
+const max_headers = 64
+
+/*
+Return all the request headers with one call into C, or two if there are more than
+max_headers. The names are lowercase.
+*/
+func Get_headers(s unsafe.Pointer) (map[string]string) {
+  var small [max_headers * 2]*C.char
+  pairs := small[:]
+  count := int(C.get_headers((*C.servlet)(s), &pairs[0], max_headers))
+  if count > max_headers {
+    pairs = make([]*C.char, count * 2)
+    count = int(C.get_headers((*C.servlet)(s), &pairs[0], C.size_t(count)))
+  }
+  headers := make(map[string]string, count)
+  for i := 0; i < count; i++ {
+    // C.GoString copies in Go and does not call into C.
+    headers[C.GoString(pairs[i * 2])] = C.GoString(pairs[i * 2 + 1])
+  }
+  return headers
 }
 
 func Set_status(s unsafe.Pointer, status int32) {
@@ -44,19 +76,139 @@ func Set_status(s unsafe.Pointer, status int32) {
 }
 
 func Set_header(s unsafe.Pointer, name string, value string) {
-  name_ptr := to_ptr(name)
-  value_ptr := to_ptr(value)
-  C.set_header((*C.servlet)(s), (*C.char)(name_ptr), (*C.char)(value_ptr))
+  name_cstr := to_cstring(name)
+  value_cstr := to_cstring(value)
+  C.set_header((*C.servlet)(s), (*C.char)(unsafe.Pointer(&name_cstr[0])),
+    (*C.char)(unsafe.Pointer(&value_cstr[0])))
+  runtime.KeepAlive(name_cstr)
+  runtime.KeepAlive(value_cstr)
 }
 
+// Write the string without copying it.
 func Rwrite(s unsafe.Pointer, buffer string) (C.size_t) {
-  buffer_ptr := to_ptr(buffer)
-  return C.rwrite((*C.servlet)(s), (*C.char)(buffer_ptr), C.size_t(len(buffer)))
+  if len(buffer) == 0 {
+    return 0
+  }
+  written := C.rwrite((*C.servlet)(s), string_data(buffer), C.size_t(len(buffer)))
+  runtime.KeepAlive(buffer)
+  return written
+}
+
+// Write the bytes of the slice without copying them.
+func RwriteBytes(s unsafe.Pointer, buffer []byte) (int) {
+  if len(buffer) == 0 {
+    return 0
+  }
+  written := C.rwrite((*C.servlet)(s), (*C.char)(unsafe.Pointer(&buffer[0])),
+    C.size_t(len(buffer)))
+  return int(written)
+}
+
+/*
+Write the slices as one buffer with one call into C and without copying them. The slices 
+are pinned while C holds pointers to them. This needs Go 1.21.
+*/
+func Rwritev(s unsafe.Pointer, buffers [][]byte) (int) {
+  if len(buffers) == 0 {
+    return 0
+  }
+  var pinner runtime.Pinner
+  defer pinner.Unpin()
+  iov := make([]C.struct_iovec, 0, len(buffers))
+  for _, buffer := range buffers {
+    if len(buffer) == 0 {
+      continue
+    }
+    pinner.Pin(&buffer[0])
+    iov = append(iov, C.struct_iovec{
+      iov_base: unsafe.Pointer(&buffer[0]),
+      iov_len: C.size_t(len(buffer)),
+    })
+  }
+  if len(iov) == 0 {
+    return 0
+  }
+  written := C.rwritev((*C.servlet)(s), &iov[0], C.int(len(iov)))
+  return int(written)
 }
 
 func Rflush(s unsafe.Pointer) {
   C.rflush((*C.servlet)(s))
 }
 
+var ErrShortWrite = errors.New("modserver: the response was not fully written")
+
+/*
+Writer is an io.Writer that collects the response in Go and calls into C once for each
+full buffer and on Flush. The servlet must call Flush before returning.
+
+// Example:
+w := api.NewWriter(s)
+json.NewEncoder(w).Encode(value)
+w.Flush()
+*/
+type Writer struct {
+  s unsafe.Pointer
+  buf []byte
+}
+
+// The default buffer size of NewWriter.
+const writer_size = 32 * 1024
+
+func NewWriter(s unsafe.Pointer) (*Writer) {
+  return NewWriterSize(s, writer_size)
+}
+
+func NewWriterSize(s unsafe.Pointer, size int) (*Writer) {
+  return &Writer{s: s, buf: make([]byte, 0, size)}
+}
+
+func (w *Writer) Write(p []byte) (int, error) {
+  if len(w.buf) + len(p) > cap(w.buf) {
+    if err := w.Flush(); err != nil {
+      return 0, err
+    }
+    if len(p) >= cap(w.buf) {
+      // Write large slices without copying them into the buffer.
+      if RwriteBytes(w.s, p) != len(p) {
+        return 0, ErrShortWrite
+      }
+      return len(p), nil
+    }
+  }
+  w.buf = append(w.buf, p...)
+  return len(p), nil
+}
+
+func (w *Writer) WriteString(str string) (int, error) {
+  if len(w.buf) + len(str) > cap(w.buf) {
+    if err := w.Flush(); err != nil {
+      return 0, err
+    }
+    if len(str) >= cap(w.buf) {
+      if int(Rwrite(w.s, str)) != len(str) {
+        return 0, ErrShortWrite
+      }
+      return len(str), nil
+    }
+  }
+  w.buf = append(w.buf, str...)
+  return len(str), nil
+}
+
+// Hand the buffered bytes to the server. Rflush sends them on to the user.
+func (w *Writer) Flush() (error) {
+  if len(w.buf) == 0 {
+    return nil
+  }
+  written := RwriteBytes(w.s, w.buf)
+  short := written != len(w.buf)
+  w.buf = w.buf[:0]
+  if short {
+    return ErrShortWrite
+  }
+  return nil
+}
+
 // https://github.com/golang/go/wiki/cgo
 // https://github.com/golang/go/issues/14985
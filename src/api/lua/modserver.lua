@@ -4,7 +4,12 @@ languages that can call C. Additional API wrappers are available for other langu
 --]]
 local api = {}
 
+local cutil = require("cutil")
+local event = require("event")
+local h2 = require("h2")
 local http = require("http")
+local sse = require("sse")
+local websocket = require("websocket")
 
 function api:get_arg(name)
   return self.request.query[name]
@@ -26,52 +31,238 @@ function api:get_header(name)
   return self.request.headers[name:lower()]
 end
 
+--[[
+Header lines written for most responses, interned once rather than built per response.
+--]]
+local server_line = "Server: modserver\r\n"
+local chunked_line = "Transfer-Encoding: chunked\r\n"
+local content_type_line = "Content-Type: text/html; charset=UTF-8\r\n"
+local connection_line = "Connection: close\r\n"
+
 function api:write_status_line_and_headers()
-  local file = self.clientfd_write
-  http.write_status_line(file, self.status or 200)
-  self:set_header("Server", "modserver")
-  if not self.response_headers["content-length"] then
-    self:set_header("Transfer-Encoding", "chunked")
-  end
-  if not self.response_headers["content-type"] then
-    self:set_header("Content-Type", "text/html; charset=UTF-8")
+  if self.h2 then
+    -- A stream of an HTTP/2 connection. See h2.lua.
+    return h2.write_headers(self)
   end
-  if not self.response_headers["connection"] then
-    self:set_header("Connection", "close")
+  local headers = self.response_headers
+  -- The server sets Server and Date itself.
+  headers["server"], headers["date"] = nil, nil
+  -- A body without Content-Length is always chunked, whatever the servlet set.
+  local framed = headers["content-length"]
+  if not framed then
+    headers["transfer-encoding"] = nil
   end
-  http.write_headers(file, self.response_headers)
-  assert(file:write("\r\n"))
+  -- Assemble the status line and headers in one string and write it at once.
+  assert(self.clientfd_write:write(
+    http.status_line(self.status or 200)
+    .. server_line
+    .. "Date: " .. http.date() .. "\r\n"
+    .. (framed and "" or chunked_line)
+    .. (headers["content-type"] and "" or content_type_line)
+    .. (headers["connection"] and "" or connection_line)
+    .. http.header_lines(headers)
+    .. "\r\n"
+  ))
   self.response_headers_written = true
+  -- Decide the framing of the body once rather than on each write.
+  if self:get_method() == "HEAD" then
+    self.response_body = "none"
+  elseif self.response_headers["content-length"] then
+    self.response_body = "identity"
+  else
+    self.response_body = "chunked"
+  end
 end
 
-local function api_rwrite(self, buffer)
+-- Implemented in C because it is called for every write. See util.c.
+api.rwrite = cutil.rwrite
+
+function api:rflush()
   local file = self.clientfd_write
-  if not self.response_headers_written then
+  file:flush()
+end
+
+--[[
+Finish the response after the servlet returns: write an empty response if the servlet 
+wrote nothing and the last chunk of a chunked response.
+--]]
+function api:end_response()
+  if not self.response_headers_written and not self.response_error then
+    --[[
+    The servlet did not write any data.
+    --]]
+    self:set_status(204)
+    self:set_header("Content-Length", "0")
     self:write_status_line_and_headers()
   end
-  if self:get_method() == "HEAD" then
-    return #buffer
-  end
-  if not self.response_headers["content-length"] then
-    return http.write_chunk(file, buffer)
-  else
-    if assert(file:write(buffer)) then
-      return #buffer
+  if self.response_body == "chunked" and not self.response_error then
+    -- Send the last chunk of the chunked response.
+    if self.deferred then
+      self:send_deferred("0\r\n\r\n")
+    else
+      assert(self.clientfd_write:write("0\r\n\r\n"))
     end
   end
 end
 
-function api:rwrite(buffer)
-  local ok, ret, errstr, errnum = pcall(api_rwrite, self, buffer)
-  if ok then
-    return #buffer
+--[[
+Write framed output to the connection of a deferred request through the event loop, which 
+queues what a slow client does not take instead of blocking the child. rwrite() and the C 
+API write this way once the request is deferred. See event.send().
+--]]
+function api:send_deferred(data)
+  return event.send(self, data)
+end
+
+--[[
+Detach the request from the servlet. The connection stays open after run() returns and 
+the child process goes back to accepting connections. The request continues in a 
+callback registered with one of the resume functions below, which is called with the 
+same servlet state and writes the response as run() would. The response ends when a 
+callback calls finish().
+
+--Example:
+function servlet:run()
+  self:defer()
+  self:resume_after(1000, function(self)
+    self:rwrite("one second later")
+    self:finish()
+  end)
+end
+--]]
+function api:defer()
+  self.deferred = true
+  return self
+end
+
+-- Call callback(self) once fd is readable or closed.
+function api:resume_on_readable(fd, callback)
+  event.watch(self, fd, callback)
+end
+
+-- Call callback(self) after the given number of milliseconds.
+function api:resume_after(milliseconds, callback)
+  event.timer(self, milliseconds, callback)
+end
+
+--[[
+Call callback(self) the next time the event loop runs. Another request handled by the 
+same child uses this to wake a deferred request.
+--]]
+function api:resume(callback)
+  event.resume(self, callback)
+end
+
+-- End the response of a deferred request and close the connection.
+function api:finish()
+  event.finish(self)
+end
+
+--[[
+Turn the response into a Server-Sent Events stream. The request is deferred and stays open 
+until the client leaves or a callback calls finish(). See sse.lua.
+
+--Example:
+function servlet:run()
+  self:sse_start()
+  self:resume_after(1000, function(self)
+    self:sse_send("tick", os.date())
+  end)
+end
+--]]
+function api:sse_start()
+  sse.start(self)
+end
+
+--[[
+Send an event. The data may have several lines. The event name and id are optional. Return 
+true if the event was written.
+--]]
+function api:sse_send(event_name, data, id)
+  return sse.send(self, event_name, data, id)
+end
+
+-- Start the stream and send it every message published to the broadcast channel.
+function api:sse_subscribe(channel)
+  sse.subscribe(self, channel)
+end
+
+--[[
+Publish an event to the subscribers of a broadcast channel in every child. Return the 
+sequence number of the message, or nil and an error message.
+--]]
+function api:sse_publish(channel, event_name, data, id)
+  return sse.publish(channel, event_name, data, id)
+end
+
+--[[
+Answer a WebSocket handshake and keep the connection open in the event loop of the child. 
+Return self, or nil and an error message after writing an error response if the request is 
+not a valid handshake. See websocket.lua.
+
+--Example:
+function servlet:run()
+  if self:ws_upgrade() then
+    self:ws_on_message(function(self, message, kind)
+      if message then
+        self:ws_send(message, kind)
+      end
+    end)
   end
-  return ret, errstr, errnum
+end
+--]]
+function api:ws_upgrade()
+  return websocket.upgrade(self)
 end
 
-function api:rflush()
-  local file = self.clientfd_write
-  file:flush()
+--[[
+Call callback(self, message, kind) for each message the client sends. The kind is "text" 
+or "binary". The message is nil once the connection has closed.
+--]]
+function api:ws_on_message(callback)
+  websocket.on_message(self, callback)
+end
+
+-- Return the message passed to the on_message callback and its kind.
+function api:ws_recv()
+  return websocket.recv(self)
+end
+
+-- Send a "text" (the default) or "binary" message. Return true if it was written.
+function api:ws_send(message, kind)
+  return websocket.send(self, message, kind)
+end
+
+-- Send a close frame with the optional status code and reason and close the connection.
+function api:ws_close(code, reason)
+  websocket.close(self, code, reason)
+end
+
+-- Tests below this line:
+------------------------------------------------------------------------------------------
+
+if os.getenv("TEST") == "1" then
+  do
+    -- A Transfer-Encoding set by the servlet is replaced by the chunked framing of the body.
+    local file = io.tmpfile()
+    local state = setmetatable({
+      request = {method = "GET", headers = {}, query = {}},
+      clientfd_write = file,
+      response_headers_written = false,
+      response_headers = {},
+    }, {__index = api})
+    state:set_header("Transfer-Encoding", "gzip")
+    assert(state:rwrite("hello") == 5)
+    state:end_response()
+    file:seek("set")
+    local response = file:read("*a")
+    file:close()
+    local _, count = response:lower():gsub("\r\ntransfer%-encoding:", "")
+    assert(count == 1 and response:find("\r\nTransfer%-Encoding: chunked\r\n"))
+    assert(response:match("\r\n\r\n(.*)$") == "5\r\nhello\r\n0\r\n\r\n")
+  end
+
+  print("api/lua/modserver.lua test complete")
 end
 
 return api
@@ -1,6 +1,9 @@
 type
   Servlet {.pure, final.} = object
   PServlet* = ptr Servlet
+  IOVec* {.importc: "struct iovec", header: "<sys/uio.h>", final, pure.} = object
+    iov_base*: pointer
+    iov_len*: int
 
 proc get_arg*(s: PServlet, name: cstring): cstring{.cdecl, importc: "get_arg".}
 proc get_method*(s: PServlet): cstring{.cdecl, importc: "get_method".}
@@ -8,6 +11,7 @@ proc get_header*(s: PServlet, name: cstring): cstring{.cdecl, importc: "get_head
 proc set_status*(s: PServlet, status: cint): void{.cdecl, importc: "set_status".}
 proc set_header*(s: PServlet, name: cstring, value: cstring): void{.cdecl, importc: "set_header".}
 proc rwrite*(s: PServlet, buffer: cstring, length: int): int{.cdecl, importc: "rwrite".}
+proc rwritev*(s: PServlet, iov: ptr IOVec, count: cint): int{.cdecl, importc: "rwritev".}
 proc rprintf*(s: PServlet, format: cstring): cint{.cdecl, varargs, importc: "rprintf".}
 proc rflush*(s: PServlet): void{.cdecl, importc: "rflush".}
 
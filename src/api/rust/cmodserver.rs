@@ -1,15 +1,19 @@
-use std::os::raw::c_char;
+use std::io::IoSlice;
+use std::os::raw::{c_char, c_int};
 
 pub enum StructServlet { }
 pub type Servlet = StructServlet;
 
-extern {
+extern "C" {
   pub fn get_arg(s: *mut Servlet, name: *const c_char) -> *const c_char;
   pub fn get_method(s: *mut Servlet) -> *const c_char;
   pub fn get_header(s: *mut Servlet, name: *const c_char) -> *const c_char;
+  pub fn get_headers(s: *mut Servlet, headers: *mut *const c_char, max: usize) -> usize;
   pub fn set_status(s: *mut Servlet, status: u32);
   pub fn set_header(s: *mut Servlet, name: *const c_char, value: *const c_char);
   pub fn rwrite(s: *mut Servlet, buffer: *const c_char, length: usize) -> usize;
+  // IoSlice has the layout of struct iovec on Unix.
+  pub fn rwritev(s: *mut Servlet, iov: *const IoSlice, count: c_int) -> usize;
   pub fn rprintf(s: *mut Servlet, format: *const c_char, ...) -> i32;
   pub fn rflush(s: *mut Servlet);
 }
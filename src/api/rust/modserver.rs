@@ -1,74 +1,278 @@
 // Rust experts: please provide feedback if there is a better way to accomplish this.
 
 use std::ffi::{CStr, CString};
+use std::io;
+use std::io::IoSlice;
+use std::marker::PhantomData;
+use std::os::raw::{c_char, c_int};
+use std::ptr;
 
 pub mod cmodserver;
 
 pub type Servlet = cmodserver::Servlet;
 
-pub fn get_arg(s: *mut cmodserver::Servlet, name: &str) -> Option<String> {
-  unsafe {
-    let c_name = CString::new(name).unwrap();
-    let c_arg = cmodserver::get_arg(s, c_name.as_ptr());
-    if !c_arg.is_null() {
-      let arg = CStr::from_ptr(c_arg);
-      return Some(arg.to_string_lossy().into_owned());
+/*
+Names are copied to a buffer on the stack to add the NUL terminator C needs. Longer names 
+and names containing NUL fall back to a CString.
+*/
+const NAME_BUFFER_SIZE: usize = 128;
+
+fn with_c_name<T, F: FnOnce(*const c_char) -> T>(name: &str, f: F) -> T {
+  let bytes = name.as_bytes();
+  if bytes.len() < NAME_BUFFER_SIZE && !bytes.contains(&0) {
+    let mut buffer = [0u8; NAME_BUFFER_SIZE];
+    buffer[..bytes.len()].copy_from_slice(bytes);
+    f(buffer.as_ptr() as *const c_char)
+  }
+  else {
+    let c_name = CString::new(name.replace('\0', "")).unwrap();
+    f(c_name.as_ptr())
+  }
+}
+
+// The strings the server returns live until run() returns.
+unsafe fn borrow<'a>(c_str: *const c_char) -> Option<&'a [u8]> {
+  if c_str.is_null() {
+    None
+  }
+  else {
+    Some(CStr::from_ptr(c_str).to_bytes())
+  }
+}
+
+/*
+A safe handle to the servlet for the duration of one call to run(). The strings it returns 
+borrow from the request and are valid for that call without being copied.
+
+// Example:
+#[no_mangle]
+pub extern "C" fn run(s: *mut Servlet) -> u32 {
+  let mut request = unsafe { Request::from_ptr(s) };
+  let name = request.arg_str("name").unwrap_or("world");
+  let mut out = request.writer();
+  write!(out, "hello {}", name).unwrap();
+  return 0;
+}
+*/
+pub struct Request<'a> {
+  s: *mut Servlet,
+  marker: PhantomData<&'a mut Servlet>,
+}
+
+impl<'a> Request<'a> {
+  // The pointer must be the one passed to run() and must not outlive that call.
+  pub unsafe fn from_ptr(s: *mut Servlet) -> Request<'a> {
+    Request { s: s, marker: PhantomData }
+  }
+
+  pub fn as_ptr(&self) -> *mut Servlet {
+    self.s
+  }
+
+  pub fn arg(&self, name: &str) -> Option<&'a [u8]> {
+    with_c_name(name, |c_name| unsafe { borrow(cmodserver::get_arg(self.s, c_name)) })
+  }
+
+  pub fn arg_str(&self, name: &str) -> Option<&'a str> {
+    self.arg(name).and_then(|arg| std::str::from_utf8(arg).ok())
+  }
+
+  pub fn method(&self) -> &'a str {
+    unsafe {
+      let method = borrow(cmodserver::get_method(self.s)).unwrap_or(b"");
+      std::str::from_utf8(method).unwrap_or("")
+    }
+  }
+
+  pub fn header(&self, name: &str) -> Option<&'a [u8]> {
+    with_c_name(name, |c_name| unsafe { borrow(cmodserver::get_header(self.s, c_name)) })
+  }
+
+  pub fn header_str(&self, name: &str) -> Option<&'a str> {
+    self.header(name).and_then(|value| std::str::from_utf8(value).ok())
+  }
+
+  // All the request headers as (name, value) pairs with lowercase names.
+  pub fn headers(&self) -> Vec<(&'a [u8], &'a [u8])> {
+    unsafe {
+      let mut pairs: Vec<*const c_char> = vec![ptr::null(); 2 * 32];
+      let mut count = cmodserver::get_headers(self.s, pairs.as_mut_ptr(), 32);
+      if count > 32 {
+        pairs = vec![ptr::null(); 2 * count];
+        count = cmodserver::get_headers(self.s, pairs.as_mut_ptr(), count);
+      }
+      (0..count).map(|i| {
+        (borrow(pairs[i * 2]).unwrap_or(b""), borrow(pairs[i * 2 + 1]).unwrap_or(b""))
+      }).collect()
     }
-    else {
-      return None;
+  }
+
+  pub fn set_status(&mut self, status: u32) {
+    unsafe {
+      cmodserver::set_status(self.s, status);
+    }
+  }
+
+  pub fn set_header(&mut self, name: &str, value: &str) {
+    with_c_name(name, |c_name| {
+      let c_value = CString::new(value.replace('\0', "")).unwrap();
+      unsafe {
+        cmodserver::set_header(self.s, c_name, c_value.as_ptr());
+      }
+    })
+  }
+
+  // Write the bytes to the response without copying them. Return the number written.
+  pub fn rwrite(&mut self, buffer: &[u8]) -> usize {
+    if buffer.is_empty() {
+      return 0;
+    }
+    unsafe { cmodserver::rwrite(self.s, buffer.as_ptr() as *const c_char, buffer.len()) }
+  }
+
+  // Write the slices to the response as one buffer with one call. Return the number written.
+  pub fn rwritev(&mut self, buffers: &[IoSlice]) -> usize {
+    let mut written = 0;
+    for part in buffers.chunks(c_int::max_value() as usize) {
+      written += unsafe { cmodserver::rwritev(self.s, part.as_ptr(), part.len() as c_int) };
     }
+    written
+  }
+
+  pub fn rflush(&mut self) {
+    unsafe {
+      cmodserver::rflush(self.s);
+    }
+  }
+
+  pub fn writer<'r>(&'r mut self) -> Writer<'r, 'a> {
+    Writer::with_capacity(self, WRITER_CAPACITY)
   }
 }
 
-pub fn get_method(s: *mut cmodserver::Servlet) -> String {
-  unsafe {
-    let c_method = cmodserver::get_method(s);
-    let method = CStr::from_ptr(c_method);
-    return method.to_string_lossy().into_owned();
+const WRITER_CAPACITY: usize = 32 * 1024;
+
+/*
+A std::io::Write implementation that buffers the response in Rust and calls rwrite() once 
+for each full buffer and on flush(). It is flushed when dropped.
+*/
+pub struct Writer<'r, 'a: 'r> {
+  request: &'r mut Request<'a>,
+  buffer: Vec<u8>,
+}
+
+impl<'r, 'a> Writer<'r, 'a> {
+  pub fn with_capacity(request: &'r mut Request<'a>, capacity: usize) -> Writer<'r, 'a> {
+    Writer { request: request, buffer: Vec::with_capacity(capacity) }
+  }
+
+  fn write_buffer(&mut self) -> io::Result<()> {
+    if self.buffer.is_empty() {
+      return Ok(());
+    }
+    let written = self.request.rwrite(&self.buffer);
+    let length = self.buffer.len();
+    self.buffer.clear();
+    if written != length {
+      return Err(io::Error::new(io::ErrorKind::WriteZero, "the response was not written"));
+    }
+    Ok(())
   }
 }
 
-pub fn get_header(s: *mut cmodserver::Servlet, name: &str) -> Option<String> {
-  unsafe {
-    let c_name = CString::new(name).unwrap();
-    let c_value = cmodserver::get_header(s, c_name.as_ptr());
-    if !c_value.is_null() {
-      let value = CStr::from_ptr(c_value);
-      return Some(value.to_string_lossy().into_owned());
+impl<'r, 'a> io::Write for Writer<'r, 'a> {
+  fn write(&mut self, data: &[u8]) -> io::Result<usize> {
+    if self.buffer.len() + data.len() > self.buffer.capacity() {
+      self.write_buffer()?;
+      if data.len() >= self.buffer.capacity() {
+        // Write large buffers without copying them.
+        if self.request.rwrite(data) != data.len() {
+          return Err(io::Error::new(io::ErrorKind::WriteZero, "the response was not written"));
+        }
+        return Ok(data.len());
+      }
     }
-    else {
-      return None;
+    self.buffer.extend_from_slice(data);
+    Ok(data.len())
+  }
+
+  // Buffer small slices. Otherwise write the buffer and the slices with one rwritev().
+  fn write_vectored(&mut self, data: &[IoSlice]) -> io::Result<usize> {
+    let length: usize = data.iter().map(|slice| slice.len()).sum();
+    if self.buffer.len() + length <= self.buffer.capacity() {
+      for slice in data {
+        self.buffer.extend_from_slice(slice);
+      }
+      return Ok(length);
+    }
+    let buffered = self.buffer.len();
+    let mut all = Vec::with_capacity(data.len() + 1);
+    all.push(IoSlice::new(&self.buffer));
+    all.extend_from_slice(data);
+    let written = self.request.rwritev(&all);
+    self.buffer.clear();
+    if written != buffered + length {
+      return Err(io::Error::new(io::ErrorKind::WriteZero, "the response was not written"));
     }
+    Ok(length)
+  }
+
+  // Hand the buffered bytes to the server. rflush() sends them on to the user.
+  fn flush(&mut self) -> io::Result<()> {
+    self.write_buffer()
   }
 }
 
-pub fn set_status(s: *mut cmodserver::Servlet, status: u32) {
-  unsafe {
-    cmodserver::set_status(s, status);
+impl<'r, 'a> Drop for Writer<'r, 'a> {
+  fn drop(&mut self) {
+    let _ = self.write_buffer();
   }
 }
 
+/*
+The functions below take the raw servlet pointer and return owned strings. Request avoids 
+the copies.
+*/
+
+pub fn get_arg(s: *mut cmodserver::Servlet, name: &str) -> Option<String> {
+  let request = unsafe { Request::from_ptr(s) };
+  request.arg(name).map(|arg| String::from_utf8_lossy(arg).into_owned())
+}
+
+pub fn get_method(s: *mut cmodserver::Servlet) -> String {
+  let request = unsafe { Request::from_ptr(s) };
+  request.method().to_string()
+}
+
+pub fn get_header(s: *mut cmodserver::Servlet, name: &str) -> Option<String> {
+  let request = unsafe { Request::from_ptr(s) };
+  request.header(name).map(|value| String::from_utf8_lossy(value).into_owned())
+}
+
+pub fn set_status(s: *mut cmodserver::Servlet, status: u32) {
+  let mut request = unsafe { Request::from_ptr(s) };
+  request.set_status(status);
+}
+
 pub fn set_header(s: *mut cmodserver::Servlet, name: &str, value: &str) {
-  unsafe {
-    let c_name = CString::new(name).unwrap();
-    let c_value = CString::new(value).unwrap();
-    cmodserver::set_header(s, c_name.as_ptr(), c_value.as_ptr());
-  }
+  let mut request = unsafe { Request::from_ptr(s) };
+  request.set_header(name, value);
 }
 
 pub fn rwrite(s: *mut cmodserver::Servlet, buffer: Vec<u8>) -> usize {
-  unsafe {
-    let length = buffer.len();
-    let c_buffer = CString::from_vec_unchecked(buffer);
-    let ret = cmodserver::rwrite(s, c_buffer.as_ptr(), length);
-    return ret;
-  }
+  let mut request = unsafe { Request::from_ptr(s) };
+  request.rwrite(&buffer)
+}
+
+pub fn rwritev(s: *mut cmodserver::Servlet, buffers: &[&[u8]]) -> usize {
+  let mut request = unsafe { Request::from_ptr(s) };
+  let slices: Vec<IoSlice> = buffers.iter().map(|buffer| IoSlice::new(buffer)).collect();
+  request.rwritev(&slices)
 }
 
 pub fn rflush(s: *mut cmodserver::Servlet) {
-  unsafe {
-    cmodserver::rflush(s);
-  }
+  let mut request = unsafe { Request::from_ptr(s) };
+  request.rflush();
 }
 
 // https://doc.rust-lang.org/book/ffi.html
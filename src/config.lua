@@ -5,24 +5,90 @@ configuration file. The user may not even realize the syntax is Lua. This is why
 example filename is config.conf and not config.lua.
 --]]
 
+local ctls = require("ctls")
+local cutil = require("cutil")
+local errno = require("posix.errno")
 local socket = require("posix.sys.socket")
 local grp = require("posix.grp")
 local pwd = require("posix.pwd")
 local stat = require("posix.sys.stat")
+local stdlib = require("posix.stdlib")
 local unistd = require("posix.unistd")
 local util = require("util")
+local bit = bit32 or require("bit")
 
 local config = {
   cfg = {
     reload = false,
     poll_timeout = 1000,
+    max_requests_per_worker = 0,
+    max_worker_rss = 0,
+    deferred_timeout = 300,
+    sse_heartbeat = 15,
+    websocket_max_message = 1024 * 1024,
+    websocket_ping = 30,
+    http2_idle_timeout = 60,
+    cgi_timeout = 60,
   },
+  -- Broadcast channels in shared memory by name.
+  channels = {},
   modules = {},
   servlets = {},
   routes = {},
   listenfds = {},
+  -- The TLS contexts of the listening sockets with the tls option, by file descriptor.
+  tls_contexts = {},
+  -- The address string passed to listen() for each listening socket.
+  listen_addresses = {},
+  -- Listening sockets inherited from the previous server process on a reload.
+  inherited_listenfds = {},
+  --[[
+  Each servlet has a generation counter in shared memory that the parent increments when 
+  the servlet is modified. The first counter is the sum of all the others so children 
+  can tell with a single read whether any servlet changed.
+  --]]
+  generations = nil,
+  generation = 0,
+  num_generation_slots = 1,
 }
 
+--[[
+A reload re-executes the server with the listening sockets left open. Their addresses and 
+file descriptors are passed in the environment so the sockets stay open across the exec 
+and no connection is refused.
+--]]
+local LISTENFDS_ENV = "MODSERVER_LISTENFDS"
+
+function config.export_listenfds()
+  local entries = {}
+  for _, fd in ipairs(config.listenfds) do
+    util.clear_close_on_exec(fd)
+    table.insert(entries, ("%d=%s"):format(fd, config.listen_addresses[fd]))
+  end
+  stdlib.setenv(LISTENFDS_ENV, table.concat(entries, "\n"))
+end
+
+--[[
+Undo export_listenfds() after a failed exec so that programs started later, such as CGI 
+scripts, inherit neither the sockets nor their description.
+--]]
+function config.unexport_listenfds()
+  for _, fd in ipairs(config.listenfds) do
+    util.set_close_on_exec(fd)
+  end
+  stdlib.setenv(LISTENFDS_ENV, nil)
+end
+
+local function import_listenfds()
+  local str = os.getenv(LISTENFDS_ENV)
+  if str then
+    for fd, address in str:gmatch("(%d+)=([^\n]+)") do
+      config.inherited_listenfds[address] = tonumber(fd)
+    end
+    stdlib.setenv(LISTENFDS_ENV, nil)
+  end
+end
+
 --[[
 The config file is run with the config table as its environment. Only functions in the 
 config table can be called.
@@ -31,8 +97,15 @@ config table can be called.
 load_config "config.conf"
 --]]
 function config.load_config(path)
+  import_listenfds()
   local func = assert(loadfile(path, "t", config))
   assert(pcall(func))
+  -- Close inherited sockets for addresses that were removed from the config file.
+  for address, fd in pairs(config.inherited_listenfds) do
+    unistd.close(fd)
+    config.inherited_listenfds[address] = nil
+  end
+  config.generations = assert(cutil.shared_counters(config.num_generation_slots))
 end
 
 --[[
@@ -40,13 +113,45 @@ Set the address and port on which the server accepts requests.
 
 listen may be used multiple times to listen on multiple addresses.
 
+A table of options may follow the address. The tls option terminates TLS on the socket 
+with the certificate chain and private key in the given PEM files. Session tickets are 
+encrypted with the ticket_key, a file of 80 random bytes, so that they stay valid across 
+reloads and between servers that share the file. Without it every child shares a key made 
+at startup. Every ticket_key_rotation seconds (3600, or 0 to never rotate) the key is 
+replaced with a new random one, or with the ticket_key file read again if it changed. 
+Tickets made with the key before are still accepted. kTLS is used after the handshake when 
+the kernel supports it unless ktls is false. HTTP/2 is offered with ALPN unless http2 is 
+false. See tls.c.
+
 --Example:
 -- IPv4
 listen "0.0.0.0:8080"
 -- IPv6
 listen "::1:8080"
+-- TLS
+listen "0.0.0.0:443" { tls = {cert = "cert.pem", key = "key.pem"} }
+listen "0.0.0.0:8443" {
+  tls = {cert = "cert.pem", key = "key.pem", ticket_key = "ticket.key"},
+}
 --]]
+-- Return the function that takes the options table that may follow the address.
+local function listen_options(fd)
+  return function(options)
+    if options.tls then
+      config.tls_contexts[fd] = assert(ctls.context(options.tls))
+    end
+  end
+end
+
 function config.listen(str)
+  local inherited_fd = config.inherited_listenfds[str]
+  if inherited_fd then
+    config.inherited_listenfds[str] = nil
+    util.set_close_on_exec(inherited_fd)
+    table.insert(config.listenfds, inherited_fd)
+    config.listen_addresses[inherited_fd] = str
+    return listen_options(inherited_fd)
+  end
   local address, port = str:match([[(.+):(%d+)]])
   port = assert(tonumber(port), "the listen port must be a number")
   local addrinfo = assert(socket.getaddrinfo(address, port, {
@@ -62,6 +167,8 @@ function config.listen(str)
   -- The children socket inherits this option on a fork.
   assert(socket.setsockopt(fd, socket.SOL_SOCKET, socket.SO_RCVTIMEO, 5, 0))
   table.insert(config.listenfds, fd)
+  config.listen_addresses[fd] = str
+  return listen_options(fd)
 end
 
 --[[
@@ -83,6 +190,33 @@ function config.user(user, group)
   assert(unistd.setpid("u", uid))
 end
 
+--[[
+Cache the compiled bytecode of Lua servlets in a directory so that later starts and 
+reloads skip parsing the source. An entry is used only while the modification time, size, 
+and inode of the source file match. Set strip to leave out debug information, which makes 
+the bytecode smaller at the cost of line numbers in error messages. This must come before 
+the Lua servlets are loaded.
+
+Lua loads bytecode without verifying it, so a planted entry runs arbitrary code in the 
+server. The directory must belong to the user the server runs as and must not be writable 
+by anyone else or be a symbolic link. Entries that fail the same checks are ignored.
+
+--Example:
+lua_bytecode_cache "/var/cache/modserver"
+lua_bytecode_cache ("/var/cache/modserver", {strip = true})
+--]]
+function config.lua_bytecode_cache(dir, options)
+  options = options or {}
+  local ok, errmsg, errnum = stat.mkdir(dir, tonumber("700", 8))
+  assert(ok or errnum == errno.EEXIST, errmsg)
+  local dir_stat = assert(stat.lstat(dir))
+  assert(stat.S_ISDIR(dir_stat.st_mode) ~= 0, dir .. " is not a directory")
+  assert(dir_stat.st_uid == unistd.geteuid(), dir .. " must be owned by the server user")
+  local writable = bit.bor(stat.S_IWGRP, stat.S_IWOTH)
+  assert(bit.band(dir_stat.st_mode, writable) == 0, dir .. " must not be writable by others")
+  config.cfg.lua_bytecode_cache = {dir = dir, strip = options.strip == true}
+end
+
 --[[
 Modules add support for calling foreign functions of servlets. Each module defines a 
 load_servlet() function that know how to load a particular type of servlet.
@@ -138,15 +272,31 @@ function config.load_servlet(path, route)
   local mod = config.modules[extension]
   if mod then
     local ok, servlet = pcall(mod.load_servlet, path)
+    local previous = config.servlets[path]
     if ok and servlet then
       config.routes[route] = servlet
       -- print("loaded servlet:", path)
     else
       print("failed to load servlet:", servlet)
+      if previous then
+        -- Keep serving the servlet that was loaded before.
+        local stat_tbl = stat.stat(path)
+        previous.file_modified_time = stat_tbl and stat_tbl.st_mtime or 0
+        return false
+      end
       servlet = {}
     end
+    if previous then
+      servlet.generation_slot = previous.generation_slot
+    else
+      config.num_generation_slots = config.num_generation_slots + 1
+      servlet.generation_slot = config.num_generation_slots
+    end
+    servlet.generation = 0
     servlet.initialized = false
     servlet.path = path
+    servlet.route = route
+    servlet.module = mod
     local stat_tbl = stat.stat(servlet.path)
     if stat_tbl then
       servlet.file_modified_time = stat_tbl.st_mtime
@@ -154,26 +304,228 @@ function config.load_servlet(path, route)
       servlet.file_modified_time = 0
     end
     config.servlets[path] = servlet
+    return ok and servlet ~= nil
   else
     print("no module can handle extension:", extension)
   end
 end
 
+--[[
+Forward requests for the route to one or more upstream HTTP servers. An upstream is 
+"host:port" or "unix:/path/to/socket". The optional third argument is a table of options 
+described in module/proxy.lua.
+
+--Example:
+proxy_pass ("/api", "127.0.0.1:9000")
+proxy_pass ("/api", {"10.0.0.1:9000", "10.0.0.2:9000"}, {balance = "least_conn"})
+--]]
+function config.proxy_pass(route, upstreams, options)
+  local proxy = require("module.proxy")
+  local servlet = proxy.new_servlet(upstreams, options)
+  servlet.initialized = false
+  servlet.route = route
+  servlet.module = proxy
+  config.routes[route] = servlet
+end
+
+--[[
+Call the cleanup() function of a servlet that has handled a request in this process.
+--]]
+function config.cleanup_servlet(servlet)
+  if servlet.initialized and servlet.cleanup then
+    local ok, errmsg = pcall(servlet.cleanup, servlet)
+    if not ok then
+      print(errmsg)
+    end
+  end
+  servlet.initialized = false
+end
+
+--[[
+Call the cleanup() function of a modified servlet, load it again in place of the old one and 
+increment its generation so the children load it again too. Return false if the module that 
+loads the servlet cannot load the same path twice, or the servlet sets reloadable to false. 
+The caller must restart the server to pick up the change in that case.
+--]]
+function config.reload_servlet(path)
+  local servlet = config.servlets[path]
+  if servlet.module.reloadable == false or servlet.reloadable == false then
+    return false
+  end
+  config.cleanup_servlet(servlet)
+  if not config.load_servlet(servlet.path, servlet.route) then
+    -- The old servlet stays loaded here and in the children.
+    return true
+  end
+  local reloaded = config.servlets[path]
+  reloaded.generation = config.generations:add(reloaded.generation_slot, 1)
+  config.generation = config.generations:add(1, 1)
+  return true
+end
+
+--[[
+Children call this between requests. Each servlet whose generation changed since the 
+child loaded it is loaded again and initialized on its next request. Other servlets and 
+the state of their interpreters are left alone.
+--]]
+function config.reload_modified_servlets()
+  local generation = config.generations:get(1)
+  if generation == config.generation then
+    return
+  end
+  config.generation = generation
+  for path, servlet in pairs(config.servlets) do
+    local servlet_generation = config.generations:get(servlet.generation_slot)
+    local reloadable = servlet.module.reloadable ~= false and servlet.reloadable ~= false
+    if servlet.generation ~= servlet_generation and reloadable then
+      config.cleanup_servlet(servlet)
+      config.load_servlet(servlet.path, servlet.route)
+      config.servlets[path].generation = servlet_generation
+    end
+  end
+end
+
 --[[
 Automatically reload the server when a servlet is modified. This is useful for 
-development.
+development. Sending SIGHUP to the server process reloads it regardless of this setting.
 
 --Example:
 reload "on"
 --]]
 function config.reload(str)
-  if str == "on" then
-    config.cfg.reload = true
-    config.cfg.poll_timeout = 100
-  else
-    config.cfg.reload = false
-    config.cfg.poll_timeout = 1000
-  end
+  config.cfg.reload = (str == "on")
+end
+
+--[[
+Replace a child process after it has handled the given number of requests. This bounds 
+the memory growth of servlets that leak. A value of 0 disables the limit.
+
+--Example:
+max_requests_per_worker (10000)
+--]]
+function config.max_requests_per_worker(count)
+  count = assert(tonumber(count), "max_requests_per_worker must be a number")
+  assert(count >= 0, "max_requests_per_worker must not be negative")
+  config.cfg.max_requests_per_worker = count
+end
+
+--[[
+Replace a child process once its resident set size grows past the given size. The size 
+is in bytes unless it ends with K, M, or G. A value of 0 disables the limit.
+
+--Example:
+max_worker_rss "256M"
+--]]
+function config.max_worker_rss(size)
+  local number, unit = tostring(size):match("^(%d+)%s*([KkMmGg]?)$")
+  number = assert(tonumber(number), "max_worker_rss must be a size such as 256M")
+  local multiplier = {
+    [""] = 1,
+    k = 1024,
+    m = 1024 * 1024,
+    g = 1024 * 1024 * 1024,
+  }
+  config.cfg.max_worker_rss = number * multiplier[unit:lower()]
+end
+
+--[[
+Finish a deferred request that is still open after the given number of seconds. This keeps 
+a servlet that never calls finish() from holding the connection and the child process 
+forever. A value of 0 disables the limit.
+
+--Example:
+deferred_timeout (300)
+--]]
+function config.deferred_timeout(seconds)
+  seconds = assert(tonumber(seconds), "deferred_timeout must be a number")
+  assert(seconds >= 0, "deferred_timeout must not be negative")
+  config.cfg.deferred_timeout = seconds
+end
+
+--[[
+Send a comment line to each event stream every given number of seconds. This keeps proxies 
+from closing idle streams and finds the clients that have left. A value of 0 disables the 
+heartbeat.
+
+--Example:
+sse_heartbeat (15)
+--]]
+function config.sse_heartbeat(seconds)
+  seconds = assert(tonumber(seconds), "sse_heartbeat must be a number")
+  assert(seconds >= 0, "sse_heartbeat must not be negative")
+  config.cfg.sse_heartbeat = seconds
+end
+
+--[[
+Close a WebSocket connection with status 1009 when the client sends a message larger than 
+this many bytes.
+
+--Example:
+websocket_max_message (1048576)
+--]]
+function config.websocket_max_message(size)
+  size = assert(tonumber(size), "websocket_max_message must be a number")
+  assert(size > 0, "websocket_max_message must be positive")
+  config.cfg.websocket_max_message = size
+end
+
+--[[
+Send a ping to each WebSocket connection every given number of seconds and close the 
+connections that did not answer the last one. A value of 0 disables the ping.
+
+--Example:
+websocket_ping (30)
+--]]
+function config.websocket_ping(seconds)
+  seconds = assert(tonumber(seconds), "websocket_ping must be a number")
+  assert(seconds >= 0, "websocket_ping must not be negative")
+  config.cfg.websocket_ping = seconds
+end
+
+--[[
+Close an HTTP/2 connection that has had no open streams for the given number of seconds. 
+A value of 0 keeps idle connections open until the client closes them.
+
+--Example:
+http2_idle_timeout (60)
+--]]
+function config.http2_idle_timeout(seconds)
+  seconds = assert(tonumber(seconds), "http2_idle_timeout must be a number")
+  assert(seconds >= 0, "http2_idle_timeout must not be negative")
+  config.cfg.http2_idle_timeout = seconds
+end
+
+--[[
+Stop a CGI or SCGI script that has neither read input nor written output for the given 
+number of seconds. The request fails and a persistent script is started again. A value of 
+0 waits forever.
+
+--Example:
+cgi_timeout (60)
+--]]
+function config.cgi_timeout(seconds)
+  seconds = assert(tonumber(seconds), "cgi_timeout must be a number")
+  assert(seconds >= 0, "cgi_timeout must not be negative")
+  config.cfg.cgi_timeout = seconds
+end
+
+--[[
+Declare a broadcast channel for Server-Sent Events. Servlets in any child publish to the 
+channel and the subscribers in every child receive the messages. The channel keeps the 
+last slots messages of up to size bytes in shared memory. Each child with subscribers 
+checks for new messages every interval milliseconds.
+
+--Example:
+broadcast_channel "dashboard"
+broadcast_channel ("dashboard", {slots = 1024, size = 4096, interval = 50})
+--]]
+function config.broadcast_channel(name, options)
+  options = options or {}
+  local slots = assert(tonumber(options.slots or 1024), "slots must be a number")
+  local size = assert(tonumber(options.size or 4096), "size must be a number")
+  local interval = assert(tonumber(options.interval or 50), "interval must be a number")
+  local channel = assert(cutil.broadcast(slots, size))
+  config.channels[name] = {channel = channel, interval = interval}
 end
 
 return config
@@ -0,0 +1,453 @@
+--[[
+The event loop of a child process. A servlet that calls defer() returns from run()
+without finishing its response. The child keeps the connection open, goes back to
+accepting connections, and resumes the request from here when a file descriptor the
+servlet waits on becomes readable, when a timer expires, or when another request asks for
+it. One child can park any number of long-poll requests this way.
+--]]
+local event = {}
+
+local cutil = require("cutil")
+local stdio = require("posix.stdio")
+
+-- Deferred requests that have not finished, as a set of servlet state tables.
+local parked = {}
+local num_parked = 0
+
+--[[
+Callbacks waiting for a file descriptor to become readable, as lists by file descriptor.
+Several requests may wait on the same descriptor, such as the read end of a pipe that
+announces new messages.
+--]]
+local watches = {}
+-- File descriptors whose watches changed since the child last updated its poll set.
+local changed_fds = {}
+
+-- Timers in a binary min-heap ordered by when they are due.
+local timers = {}
+
+-- Callbacks to call on the next turn of the loop.
+local ready = {}
+
+--[[
+Output of deferred requests that their socket did not take yet, as lists of strings by
+file descriptor. See event.send().
+--]]
+local outgoing = {}
+-- A client that lets more than this many bytes pile up is disconnected.
+local MAX_OUTGOING = 4 * 1024 * 1024
+-- A finished request whose client does not take the rest within this many ms is closed.
+local FINISH_TIMEOUT = 30 * 1000
+
+local function heap_push(timer)
+  local i = #timers + 1
+  timers[i] = timer
+  while i > 1 do
+    local parent = math.floor(i / 2)
+    if timers[parent].due <= timer.due then
+      break
+    end
+    timers[i], timers[parent] = timers[parent], timer
+    i = parent
+  end
+end
+
+local function heap_pop()
+  local top = timers[1]
+  local last = table.remove(timers)
+  local count = #timers
+  if count > 0 then
+    local i = 1
+    timers[1] = last
+    while true do
+      local smallest = i
+      local left, right = i * 2, i * 2 + 1
+      if left <= count and timers[left].due < timers[smallest].due then
+        smallest = left
+      end
+      if right <= count and timers[right].due < timers[smallest].due then
+        smallest = right
+      end
+      if smallest == i then
+        break
+      end
+      timers[i], timers[smallest] = timers[smallest], timers[i]
+      i = smallest
+    end
+  end
+  return top
+end
+
+--[[
+Called by the child after run() returns for a request that called defer(). The request is
+finished after the deferred_timeout directive so a servlet that forgets it cannot keep the
+connection and the child forever.
+--]]
+function event.park(state, timeout)
+  if state.finished then
+    return
+  end
+  parked[state] = true
+  num_parked = num_parked + 1
+  if timeout and timeout > 0 then
+    event.timer(state, timeout * 1000, function(self)
+      self:finish()
+    end)
+  end
+end
+
+-- Return the number of deferred requests that have not finished.
+function event.count()
+  return num_parked
+end
+
+function event.watch(state, fd, callback)
+  local list = watches[fd]
+  if not list then
+    list = {}
+    watches[fd] = list
+    changed_fds[fd] = true
+  end
+  table.insert(list, {state = state, callback = callback})
+end
+
+--[[
+Call callback(state) after the given number of milliseconds. The state may be nil for a 
+timer of the child itself rather than of a request.
+--]]
+function event.timer(state, milliseconds, callback)
+  heap_push({state = state, callback = callback, due = cutil.now() + milliseconds})
+end
+
+function event.resume(state, callback)
+  table.insert(ready, {state = state, callback = callback})
+end
+
+--[[
+Return the descriptor that event.send() writes to for the state, or false if the
+connection has none of its own: a stream of an HTTP/2 connection, or TLS in user space.
+--]]
+local function output_fd(state)
+  if state.output_fd == nil then
+    local fd = false
+    local file = state.clientfd_write
+    local tls = state.tls
+    if not state.h2 and (not tls or tls.ktls_send) and io.type(file) == "file" then
+      fd = stdio.fileno(file) or false
+    end
+    state.output_fd = fd
+  end
+  return state.output_fd
+end
+
+-- Close the connection of a finished request and call its on_finish().
+local function close(state)
+  state.clientfd_read:close()
+  state.clientfd_write:close()
+  if parked[state] then
+    parked[state] = nil
+    num_parked = num_parked - 1
+  end
+  if state.on_finish then
+    local ok, errmsg = pcall(state.on_finish, state)
+    if not ok then
+      print(errmsg)
+    end
+  end
+end
+
+--[[
+Write what is queued for fd, and close the connection of a finished request once the queue
+is empty. Return false and remember the error in response_error if the connection failed.
+--]]
+local function flush(fd, queue)
+  local data = table.concat(queue)
+  local written, errmsg = cutil.write_available(queue.state.clientfd_write, fd, data)
+  if written and written < #data then
+    for i = #queue, 2, -1 do
+      queue[i] = nil
+    end
+    queue[1], queue.size = data:sub(written + 1), #data - written
+    return true
+  end
+  outgoing[fd] = nil
+  changed_fds[fd] = true
+  if not written then
+    queue.state.response_error = queue.state.response_error or errmsg
+  end
+  if queue.state.finished then
+    close(queue.state)
+  end
+  return written ~= nil
+end
+
+--[[
+Write data to the connection of a deferred request without blocking the child. What the
+socket does not take now is queued, after anything queued before it, and written when
+poll() reports the socket as writable. Return false if the connection failed or the
+client let too much pile up, which is remembered in response_error like a failed rwrite().
+A connection without a descriptor of its own is written and flushed at once instead.
+--]]
+function event.send(state, data)
+  if state.response_error or state.finished then
+    return false
+  end
+  local fd = output_fd(state)
+  if not fd then
+    local file = state.clientfd_write
+    local ok, errmsg = file:write(data)
+    if ok then
+      ok, errmsg = file:flush()
+    end
+    if not ok then
+      state.response_error = errmsg or "write failed"
+    end
+    return not state.response_error
+  end
+  local queue = outgoing[fd]
+  if queue then
+    if queue.size + #data > MAX_OUTGOING then
+      state.response_error = "the client does not read its response"
+      return false
+    end
+    table.insert(queue, data)
+    queue.size = queue.size + #data
+    return true
+  end
+  local written, errmsg = cutil.write_available(state.clientfd_write, fd, data)
+  if not written then
+    state.response_error = errmsg
+    return false
+  end
+  if written < #data then
+    outgoing[fd] = {state = state, size = #data - written, data:sub(written + 1)}
+    changed_fds[fd] = true
+  end
+  return true
+end
+
+--[[
+End the response of a deferred request and forget its callbacks. Timers of a finished 
+request are dropped when they come due. The connection is closed once the socket has taken 
+what is queued for it, or after FINISH_TIMEOUT if the client stops reading, so a slow client 
+still gets the whole response. Then on_finish(state) is called if the state has it, which 
+the C API uses to let a servlet free what its callbacks used.
+--]]
+function event.finish(state)
+  if state.finished then
+    return
+  end
+  if not state.response_error then
+    pcall(state.end_response, state)
+  end
+  state.finished = true
+  for fd, list in pairs(watches) do
+    for i = #list, 1, -1 do
+      if list[i].state == state then
+        table.remove(list, i)
+      end
+    end
+    if #list == 0 then
+      watches[fd] = nil
+      changed_fds[fd] = true
+    end
+  end
+  local fd = state.output_fd
+  local queue = fd and outgoing[fd]
+  if queue and queue.state == state and not state.response_error then
+    -- flush() closes the connection once the queue is empty.
+    event.timer(nil, FINISH_TIMEOUT, function()
+      if outgoing[fd] == queue then
+        outgoing[fd] = nil
+        changed_fds[fd] = true
+        close(state)
+      end
+    end)
+    return
+  end
+  if queue and queue.state == state then
+    outgoing[fd] = nil
+    changed_fds[fd] = true
+  end
+  close(state)
+end
+
+--[[
+Call a callback of a deferred request. A callback that raises an error finishes the
+request like a servlet that raises an error in run().
+--]]
+local function call(entry)
+  local state = entry.state
+  if state and state.finished then
+    return
+  end
+  local ok, errmsg = pcall(entry.callback, state)
+  if not ok then
+    print(errmsg)
+    if state then
+      state.response_error = state.response_error or errmsg
+      event.finish(state)
+    end
+  end
+end
+
+--[[
+Add the file descriptors that deferred requests wait on to the poll set of the child and
+remove the ones no request waits on anymore. A descriptor with queued output waits until
+it is writable.
+--]]
+function event.update_poll_fds(poll_fds)
+  for fd in pairs(changed_fds) do
+    if watches[fd] or outgoing[fd] then
+      local entry = poll_fds[fd] or {}
+      entry.events = {IN = watches[fd] ~= nil, OUT = outgoing[fd] ~= nil}
+      poll_fds[fd] = entry
+    else
+      poll_fds[fd] = nil
+    end
+    changed_fds[fd] = nil
+  end
+end
+
+-- Return the poll() timeout in milliseconds, which is no later than the next timer.
+function event.timeout(timeout)
+  if #ready > 0 then
+    return 0
+  end
+  local timer = timers[1]
+  if timer then
+    local remaining = math.max(0, math.ceil(timer.due - cutil.now()))
+    if timeout < 0 or remaining < timeout then
+      return remaining
+    end
+  end
+  return timeout
+end
+
+-- Return true if fd belongs to a deferred request rather than to the child.
+function event.is_watched(fd)
+  return watches[fd] ~= nil or outgoing[fd] ~= nil
+end
+
+--[[
+Write the queued output that poll() reported room for, and call the callbacks whose file
+descriptor poll() reported as readable or closed, whose timer is due, or that were passed
+to resume(). Each callback is called once. Callbacks registered while dispatching wait for
+the next turn of the loop.
+--]]
+function event.dispatch(poll_fds)
+  local failed = {}
+  for fd, queue in pairs(outgoing) do
+    local revents = poll_fds[fd] and poll_fds[fd].revents
+    if revents and (revents.OUT or revents.HUP or revents.ERR) and not flush(fd, queue) then
+      table.insert(failed, queue.state)
+    end
+  end
+  for _, state in ipairs(failed) do
+    event.finish(state)
+  end
+  local due = {}
+  for fd, list in pairs(watches) do
+    local revents = poll_fds[fd] and poll_fds[fd].revents
+    if revents and (revents.IN or revents.HUP or revents.ERR) then
+      watches[fd] = nil
+      changed_fds[fd] = true
+      for _, entry in ipairs(list) do
+        table.insert(due, entry)
+      end
+    end
+  end
+  local now = cutil.now()
+  while timers[1] and timers[1].due <= now do
+    table.insert(due, heap_pop())
+  end
+  for _, entry in ipairs(ready) do
+    table.insert(due, entry)
+  end
+  ready = {}
+  for _, entry in ipairs(due) do
+    call(entry)
+  end
+end
+
+-- Tests below this line:
+------------------------------------------------------------------------------------------
+
+if os.getenv("TEST") == "1" then
+  do
+    local order = {}
+    for _, due in ipairs{5, 3, 9, 1, 7, 3} do
+      heap_push({due = due})
+    end
+    while timers[1] do
+      table.insert(order, heap_pop().due)
+    end
+    assert(table.concat(order, " ") == "1 3 3 5 7 9")
+  end
+
+  do
+    local closed = 0
+    local file = {close = function() closed = closed + 1 end}
+    local state = {clientfd_read = file, clientfd_write = file, end_response = function() end}
+    local calls = {}
+    state.on_finish = function() table.insert(calls, "on_finish") end
+    event.park(state)
+    assert(event.count() == 1)
+    event.watch(state, 100, function() table.insert(calls, "fd") end)
+    event.resume(state, function() table.insert(calls, "resume") end)
+    event.timer(state, 0, function() table.insert(calls, "timer") end)
+    local poll_fds = {}
+    event.update_poll_fds(poll_fds)
+    assert(poll_fds[100] and event.is_watched(100))
+    assert(event.timeout(5000) == 0)
+    poll_fds[100].revents = {IN = true}
+    event.dispatch(poll_fds)
+    assert(table.concat(calls, " ") == "fd timer resume")
+    event.update_poll_fds(poll_fds)
+    assert(not poll_fds[100])
+    event.resume(state, function(self) error("callback error") end)
+    -- Keep the error message out of the test output.
+    local print_ = print
+    print = function() end
+    event.dispatch(poll_fds)
+    print = print_
+    assert(state.finished and closed == 2 and event.count() == 0)
+    assert(calls[#calls] == "on_finish")
+  end
+
+  do
+    -- Output that the socket does not take waits until poll() reports it writable.
+    local socket = require("posix.sys.socket")
+    local unistd = require("posix.unistd")
+    local fd, peer = socket.socketpair(socket.AF_UNIX, socket.SOCK_STREAM, 0)
+    local file = stdio.fdopen(fd, "w")
+    local state = {clientfd_read = {close = function() end}, clientfd_write = file}
+    state.end_response = function(self) event.send(self, "!") end
+    local closed = false
+    state.on_finish = function() closed = true end
+    local data = ("x"):rep(1024 * 1024)
+    assert(event.send(state, data) and event.send(state, "end"))
+    -- A finished request keeps its connection until the client has taken the rest.
+    event.park(state)
+    event.finish(state)
+    assert(not closed and event.count() == 1 and not event.send(state, "late"))
+    local poll_fds = {}
+    event.update_poll_fds(poll_fds)
+    assert(poll_fds[fd].events.OUT and event.is_watched(fd))
+    local received = {}
+    while #table.concat(received) < #data + 4 do
+      table.insert(received, unistd.read(peer, 65536))
+      poll_fds[fd].revents = {OUT = true}
+      event.dispatch(poll_fds)
+    end
+    assert(table.concat(received) == data .. "end!")
+    assert(closed and event.count() == 0)
+    event.update_poll_fds(poll_fds)
+    assert(not poll_fds[fd] and not event.is_watched(fd))
+    unistd.close(peer)
+  end
+
+  print("event.lua test complete")
+end
+
+return event
@@ -0,0 +1,57 @@
+#define MODSERVER_ABI 2
+#include <stdlib.h>
+#include "modserver.h"
+
+/*
+The same output as sleep.c, but the process serves other requests while this one waits 
+between counts.
+*/
+
+int modserver_init(const modserver_api *api)
+{
+  return api->version >= 3 ? 0 : -1;
+}
+
+// The count is freed however the request ends, including when the client goes away.
+static void free_count(servlet *s, void *data)
+{
+  (void)s;
+  free(data);
+}
+
+static void tick(servlet *s, void *data)
+{
+  int *count = data;
+  if (*count < 5)
+  {
+    rprintf(s, "count: %i\n", (*count)++);
+    rflush(s);
+    if (resume_after(s, 1000, tick, count) != 0)
+    {
+      finish(s);
+    }
+    return;
+  }
+  rprintf(s, "done\n");
+  finish(s);
+}
+
+int run(servlet *s)
+{
+  set_header(s, "Content-Type", "text/plain; charset=UTF-8");
+  int *count = malloc(sizeof(int));
+  if (!count)
+  {
+    return -1;
+  }
+  *count = 0;
+  servlet *deferred = defer(s);
+  if (!deferred)
+  {
+    free(count);
+    return -1;
+  }
+  on_finish(deferred, free_count, count);
+  tick(deferred, count);
+  return 0;
+}
@@ -0,0 +1,31 @@
+#define MODSERVER_ABI 2
+#include "modserver.h"
+
+static unsigned long requests;
+
+int modserver_init(const modserver_api *api)
+{
+  return api->version >= 2 ? 0 : -1;
+}
+
+int run(servlet *s)
+{
+  set_header(s, "Content-Type", "text/plain; charset=UTF-8");
+  const char reply[] = "hello from C through ABI version 2\n";
+  rwrite(s, reply, sizeof(reply) - 1);
+  rprintf(s, "method: %s\n", get_method(s));
+  const char *user_agent = get_header(s, "User-Agent");
+  rprintf(s, "user agent: %s\n", user_agent ? user_agent : "none");
+  const char *arg = get_arg(s, "arg");
+  if (arg)
+  {
+    rprintf(s, "arg: %s\n", arg);
+  }
+  rprintf(s, "requests handled by this process: %lu\n", ++requests);
+  return 0;
+}
+
+void cleanup(void)
+{
+  requests = 0;
+}
@@ -28,6 +28,13 @@ int run(servlet *s)
   
   rprintf(s, "The number is: %u\n", 42);
   
+  struct iovec iov[] = {
+    {.iov_base = "one ", .iov_len = 4},
+    {.iov_base = "write\n", .iov_len = 6},
+  };
+  size_t written = rwritev(s, iov, 2);
+  assert(written == 10);
+  
   rflush(s);
     
   return 0;
@@ -0,0 +1,68 @@
+#define MODSERVER_ABI 2
+#include <stddef.h>
+#include "modserver.h"
+
+/*
+A chat room. Every message a WebSocket client sends goes to all the clients connected to 
+the same process. The process keeps the connections open between messages.
+*/
+
+#define MAX_CLIENTS 64
+
+static servlet *clients[MAX_CLIENTS];
+
+int modserver_init(const modserver_api *api)
+{
+  return api->version >= 2 ? 0 : -1;
+}
+
+static void message(servlet *s, void *data)
+{
+  servlet **slot = data;
+  size_t length;
+  int binary;
+  const char *text = ws_recv(s, &length, &binary);
+  if (!text)
+  {
+    // The client left.
+    *slot = NULL;
+    return;
+  }
+  for (int i = 0; i < MAX_CLIENTS; ++i)
+  {
+    if (clients[i])
+    {
+      ws_send(clients[i], text, length, binary);
+    }
+  }
+}
+
+int run(servlet *s)
+{
+  if (!get_header(s, "upgrade"))
+  {
+    rprintf(s, "connect a WebSocket client to chat\n");
+    return 0;
+  }
+  servlet **slot = NULL;
+  for (int i = 0; i < MAX_CLIENTS && !slot; ++i)
+  {
+    if (!clients[i])
+    {
+      slot = &clients[i];
+    }
+  }
+  if (!slot)
+  {
+    set_status(s, 503);
+    rprintf(s, "the room is full\n");
+    return 0;
+  }
+  servlet *ws = ws_upgrade(s);
+  if (ws)
+  {
+    *slot = ws;
+    ws_on_message(ws, message, slot);
+  }
+  return 0;
+}
@@ -2,6 +2,7 @@ package main
 
 import api "modserver"
 import "C"
+import "fmt"
 import "unsafe"
 
 //export run
@@ -21,6 +22,12 @@ func run(s unsafe.Pointer) int {
     api.Rwrite(s, header)
   }
   api.Rwrite(s, "\n")
+  api.RwriteBytes(s, []byte("bytes\n"))
+  w := api.NewWriter(s)
+  for name, value := range api.Get_headers(s) {
+    fmt.Fprintf(w, "%s: %s\n", name, value)
+  }
+  w.Flush()
   api.Rflush(s)
   return 0
 }
@@ -0,0 +1,40 @@
+local servlet = {}
+
+--[[
+A live feed. Open /sse?subscribe=1 with EventSource in any number of browsers, then send a 
+message to all of them with /sse?message=hello. The config file declares the "feed" 
+broadcast channel.
+--]]
+function servlet:run()
+  local message = self:get_arg("message")
+  if message then
+    local sequence, errmsg = self:sse_publish("feed", "message", message)
+    self:rwrite(sequence and "sent\n" or errmsg)
+  elseif self:get_arg("subscribe") then
+    self:sse_subscribe("feed")
+    self:sse_send("hello", "subscribed")
+  else
+    self:rwrite([[
+<!DOCTYPE html>
+<html>
+<head><title>Feed</title></head>
+<body>
+<form method="GET" target="sent">
+  <input type="text" name="message" autofocus />
+  <input type="submit" value="Send" />
+</form>
+<iframe name="sent" style="display: none"></iframe>
+<pre id="feed"></pre>
+<script>
+var source = new EventSource("?subscribe=1");
+source.addEventListener("message", function(event) {
+  document.getElementById("feed").textContent += event.data + "\n";
+});
+</script>
+</body>
+</html>
+]])
+  end
+end
+
+return servlet
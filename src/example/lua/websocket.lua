@@ -0,0 +1,43 @@
+local servlet = {}
+
+--[[
+An echo server. Open /websocket in a browser, or connect a WebSocket client to it and 
+every message comes back.
+--]]
+function servlet:run()
+  if not self:get_header("upgrade") then
+    self:rwrite([[
+<!DOCTYPE html>
+<html>
+<head><title>Echo</title></head>
+<body>
+<input type="text" id="message" autofocus />
+<pre id="log"></pre>
+<script>
+var socket = new WebSocket(location.href.replace(/^http/, "ws"));
+var input = document.getElementById("message");
+input.addEventListener("keydown", function(event) {
+  if (event.key === "Enter") {
+    socket.send(input.value);
+    input.value = "";
+  }
+});
+socket.addEventListener("message", function(event) {
+  document.getElementById("log").textContent += event.data + "\n";
+});
+</script>
+</body>
+</html>
+]])
+    return
+  end
+  if self:ws_upgrade() then
+    self:ws_on_message(function(self, message, kind)
+      if message then
+        self:ws_send(message, kind)
+      end
+    end)
+  end
+end
+
+return servlet
@@ -11,3 +11,6 @@ def run(s):
   if header:
     rwrite(s, header + "\n")
   rflush(s)
+  rwrite(s, b"bytes\n")
+  rwrite(s, memoryview(bytearray(b"memoryview\n")))
+  rwritelines(s, (line + "\n" for line in ["line 1", "line 2"]))
@@ -5,22 +5,35 @@
 #[path="../../api/rust/modserver.rs"]
 pub mod modserver;
 use modserver::*;
+use std::io::Write;
 
 #[no_mangle]
 pub extern "C" fn run(s: *mut Servlet) -> u32 {
-  set_status(s, 200);
-  set_header(s, "Content-Type", "text/plain; charset=UTF-8");
-  match get_arg(s, "arg") {
-    Some(x) => { rwrite(s, x.into_bytes()); },
-    None  => { }
+  let mut request = unsafe { Request::from_ptr(s) };
+  request.set_status(200);
+  request.set_header("Content-Type", "text/plain; charset=UTF-8");
+  let arg = request.arg("arg");
+  let method = request.method();
+  let user_agent = request.header("User-Agent");
+  let headers = request.headers();
+  let mut out = request.writer();
+  if let Some(x) = arg {
+    out.write_all(x).unwrap();
+    out.write_all(b"\n").unwrap();
   }
-  let method = get_method(s);
-  let bytes = method.into_bytes();
-  rwrite(s, bytes);
-  match get_header(s, "User-Agent") {
-    Some(x) => { rwrite(s, x.into_bytes()); },
-    None  => { }
+  writeln!(out, "{}", method).unwrap();
+  if let Some(x) = user_agent {
+    out.write_all(x).unwrap();
   }
-  rflush(s);
+  out.write_all(b"\n").unwrap();
+  for (name, value) in headers {
+    out.write_all(name).unwrap();
+    out.write_all(b": ").unwrap();
+    out.write_all(value).unwrap();
+    out.write_all(b"\n").unwrap();
+  }
+  out.flush().unwrap();
+  drop(out);
+  request.rflush();
   return 0;
 }
@@ -0,0 +1,1803 @@
+// fopencookie() and fmemopen() are GNU extensions.
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lauxlib.h>
+#include <lua.h>
+#include "luacompat.h"
+#include <fcntl.h>
+
+/*
+HTTP/2 framing and HPACK header compression (RFC 9113 and RFC 7541). h2.lua reads the
+frames of a connection from here and maps its streams onto servlet states. The frames that
+only concern the connection are answered here: SETTINGS, PING, and WINDOW_UPDATE.
+
+The response of each stream is written through a stream made with fopencookie(), so
+rwrite() and every module write DATA frames without knowing about HTTP/2. A write that
+finds the flow control window of the client closed reads frames until a WINDOW_UPDATE
+opens it and sets aside the other frames for h2.lua. If none comes within SO_RCVTIMEO the
+rest of the response is queued in the stream, and sent as the WINDOW_UPDATE frames that
+h2.lua reads from the event loop open the window.
+*/
+
+#define CONNECTION "ch2.connection"
+
+// Frame types.
+#define DATA 0x0
+#define HEADERS 0x1
+#define PRIORITY 0x2
+#define RST_STREAM 0x3
+#define SETTINGS 0x4
+#define PUSH_PROMISE 0x5
+#define PING 0x6
+#define GOAWAY 0x7
+#define WINDOW_UPDATE 0x8
+#define CONTINUATION 0x9
+
+// Frame flags.
+#define END_STREAM 0x1
+#define ACK 0x1
+#define END_HEADERS 0x4
+#define PADDED 0x8
+#define PRIORITY_FLAG 0x20
+
+// Error codes of RST_STREAM and GOAWAY.
+#define NO_ERROR 0x0
+#define PROTOCOL_ERROR 0x1
+#define FLOW_CONTROL_ERROR 0x3
+#define CANCEL 0x8
+#define FRAME_SIZE_ERROR 0x6
+#define COMPRESSION_ERROR 0x9
+
+// The largest frame the server accepts, which is the default SETTINGS_MAX_FRAME_SIZE.
+#define MAX_FRAME 16384
+// The size of the HPACK dynamic tables. 4096 is the default of both ends.
+#define HEADER_TABLE_SIZE 4096
+// The largest header list decoded from one block, as in SETTINGS_MAX_HEADER_LIST_SIZE.
+#define MAX_HEADER_LIST 65536
+#define MAX_CONCURRENT_STREAMS 100
+// The most response data a stream queues while the window of the client stays closed.
+#define MAX_QUEUED (4 << 20)
+// The receive windows advertised for each stream and for the whole connection.
+#define STREAM_WINDOW (1 << 20)
+#define CONNECTION_WINDOW (16 << 20)
+#define DEFAULT_WINDOW 65535
+#define MAX_WINDOW 0x7fffffff
+
+/*
+The static table of HPACK. Index 1 is the first entry. The dynamic table follows it from
+index 62.
+*/
+static const char *static_table[61][2] =
+{
+  {":authority", ""},
+  {":method", "GET"},
+  {":method", "POST"},
+  {":path", "/"},
+  {":path", "/index.html"},
+  {":scheme", "http"},
+  {":scheme", "https"},
+  {":status", "200"},
+  {":status", "204"},
+  {":status", "206"},
+  {":status", "304"},
+  {":status", "400"},
+  {":status", "404"},
+  {":status", "500"},
+  {"accept-charset", ""},
+  {"accept-encoding", "gzip, deflate"},
+  {"accept-language", ""},
+  {"accept-ranges", ""},
+  {"accept", ""},
+  {"access-control-allow-origin", ""},
+  {"age", ""},
+  {"allow", ""},
+  {"authorization", ""},
+  {"cache-control", ""},
+  {"content-disposition", ""},
+  {"content-encoding", ""},
+  {"content-language", ""},
+  {"content-length", ""},
+  {"content-location", ""},
+  {"content-range", ""},
+  {"content-type", ""},
+  {"cookie", ""},
+  {"date", ""},
+  {"etag", ""},
+  {"expect", ""},
+  {"expires", ""},
+  {"from", ""},
+  {"host", ""},
+  {"if-match", ""},
+  {"if-modified-since", ""},
+  {"if-none-match", ""},
+  {"if-range", ""},
+  {"if-unmodified-since", ""},
+  {"last-modified", ""},
+  {"link", ""},
+  {"location", ""},
+  {"max-forwards", ""},
+  {"proxy-authenticate", ""},
+  {"proxy-authorization", ""},
+  {"range", ""},
+  {"referer", ""},
+  {"refresh", ""},
+  {"retry-after", ""},
+  {"server", ""},
+  {"set-cookie", ""},
+  {"strict-transport-security", ""},
+  {"transfer-encoding", ""},
+  {"user-agent", ""},
+  {"vary", ""},
+  {"via", ""},
+  {"www-authenticate", ""},
+};
+/*
+The Huffman code of HPACK for each byte, and the end of string code as symbol 256. A code
+is stored in the low bits of its word, most significant bit first.
+*/
+static const uint32_t huffman_codes[257] =
+{
+  0x1ff8, 0x7fffd8, 0xfffffe2, 0xfffffe3, 0xfffffe4, 0xfffffe5, 0xfffffe6, 0xfffffe7,
+  0xfffffe8, 0xffffea, 0x3ffffffc, 0xfffffe9, 0xfffffea, 0x3ffffffd, 0xfffffeb, 0xfffffec,
+  0xfffffed, 0xfffffee, 0xfffffef, 0xffffff0, 0xffffff1, 0xffffff2, 0x3ffffffe, 0xffffff3,
+  0xffffff4, 0xffffff5, 0xffffff6, 0xffffff7, 0xffffff8, 0xffffff9, 0xffffffa, 0xffffffb,
+  0x14, 0x3f8, 0x3f9, 0xffa, 0x1ff9, 0x15, 0xf8, 0x7fa,
+  0x3fa, 0x3fb, 0xf9, 0x7fb, 0xfa, 0x16, 0x17, 0x18,
+  0x0, 0x1, 0x2, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+  0x1e, 0x1f, 0x5c, 0xfb, 0x7ffc, 0x20, 0xffb, 0x3fc,
+  0x1ffa, 0x21, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62,
+  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+  0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+  0xfc, 0x73, 0xfd, 0x1ffb, 0x7fff0, 0x1ffc, 0x3ffc, 0x22,
+  0x7ffd, 0x3, 0x23, 0x4, 0x24, 0x5, 0x25, 0x26,
+  0x27, 0x6, 0x74, 0x75, 0x28, 0x29, 0x2a, 0x7,
+  0x2b, 0x76, 0x2c, 0x8, 0x9, 0x2d, 0x77, 0x78,
+  0x79, 0x7a, 0x7b, 0x7ffe, 0x7fc, 0x3ffd, 0x1ffd, 0xffffffc,
+  0xfffe6, 0x3fffd2, 0xfffe7, 0xfffe8, 0x3fffd3, 0x3fffd4, 0x3fffd5, 0x7fffd9,
+  0x3fffd6, 0x7fffda, 0x7fffdb, 0x7fffdc, 0x7fffdd, 0x7fffde, 0xffffeb, 0x7fffdf,
+  0xffffec, 0xffffed, 0x3fffd7, 0x7fffe0, 0xffffee, 0x7fffe1, 0x7fffe2, 0x7fffe3,
+  0x7fffe4, 0x1fffdc, 0x3fffd8, 0x7fffe5, 0x3fffd9, 0x7fffe6, 0x7fffe7, 0xffffef,
+  0x3fffda, 0x1fffdd, 0xfffe9, 0x3fffdb, 0x3fffdc, 0x7fffe8, 0x7fffe9, 0x1fffde,
+  0x7fffea, 0x3fffdd, 0x3fffde, 0xfffff0, 0x1fffdf, 0x3fffdf, 0x7fffeb, 0x7fffec,
+  0x1fffe0, 0x1fffe1, 0x3fffe0, 0x1fffe2, 0x7fffed, 0x3fffe1, 0x7fffee, 0x7fffef,
+  0xfffea, 0x3fffe2, 0x3fffe3, 0x3fffe4, 0x7ffff0, 0x3fffe5, 0x3fffe6, 0x7ffff1,
+  0x3ffffe0, 0x3ffffe1, 0xfffeb, 0x7fff1, 0x3fffe7, 0x7ffff2, 0x3fffe8, 0x1ffffec,
+  0x3ffffe2, 0x3ffffe3, 0x3ffffe4, 0x7ffffde, 0x7ffffdf, 0x3ffffe5, 0xfffff1, 0x1ffffed,
+  0x7fff2, 0x1fffe3, 0x3ffffe6, 0x7ffffe0, 0x7ffffe1, 0x3ffffe7, 0x7ffffe2, 0xfffff2,
+  0x1fffe4, 0x1fffe5, 0x3ffffe8, 0x3ffffe9, 0xffffffd, 0x7ffffe3, 0x7ffffe4, 0x7ffffe5,
+  0xfffec, 0xfffff3, 0xfffed, 0x1fffe6, 0x3fffe9, 0x1fffe7, 0x1fffe8, 0x7ffff3,
+  0x3fffea, 0x3fffeb, 0x1ffffee, 0x1ffffef, 0xfffff4, 0xfffff5, 0x3ffffea, 0x7ffff4,
+  0x3ffffeb, 0x7ffffe6, 0x3ffffec, 0x3ffffed, 0x7ffffe7, 0x7ffffe8, 0x7ffffe9, 0x7ffffea,
+  0x7ffffeb, 0xffffffe, 0x7ffffec, 0x7ffffed, 0x7ffffee, 0x7ffffef, 0x7fffff0, 0x3ffffee,
+  0x3fffffff,
+};
+
+static const uint8_t huffman_lengths[257] =
+{
+  13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28,
+  28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  6, 10, 10, 12, 13, 6, 8, 11, 10, 10, 8, 11, 8, 6, 6, 6,
+  5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 15, 6, 12, 10,
+  13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 13, 19, 13, 14, 6,
+  15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6, 6, 5,
+  6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7, 15, 11, 14, 13, 28,
+  20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23,
+  24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,
+  22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23,
+  21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,
+  26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,
+  19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,
+  20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23,
+  26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,
+  30,
+};
+/*
+The Huffman codes as a binary tree made once when the module is loaded. A positive child
+is the index of a node and a negative child is a leaf holding the symbol plus one.
+*/
+static int16_t huffman_tree[256][2];
+
+static void build_huffman_tree(void)
+{
+  int nodes = 1;
+  for (int symbol = 0; symbol < 257; symbol++)
+  {
+    int node = 0;
+    for (int bit = huffman_lengths[symbol] - 1; bit > 0; bit--)
+    {
+      int b = (huffman_codes[symbol] >> bit) & 1;
+      if (huffman_tree[node][b] == 0)
+      {
+        huffman_tree[node][b] = nodes++;
+      }
+      node = huffman_tree[node][b];
+    }
+    huffman_tree[node][huffman_codes[symbol] & 1] = -(symbol + 1);
+  }
+}
+
+// A growable byte buffer.
+typedef struct buffer
+{
+  char *data;
+  size_t length;
+  size_t capacity;
+} buffer;
+
+static int buffer_reserve(buffer *b, size_t extra)
+{
+  if (b->length + extra <= b->capacity)
+  {
+    return 1;
+  }
+  size_t capacity = b->capacity ? b->capacity : 1024;
+  while (capacity < b->length + extra)
+  {
+    capacity *= 2;
+  }
+  char *data = realloc(b->data, capacity);
+  if (!data)
+  {
+    return 0;
+  }
+  b->data = data;
+  b->capacity = capacity;
+  return 1;
+}
+
+static int buffer_append(buffer *b, const void *p, size_t length)
+{
+  if (!buffer_reserve(b, length))
+  {
+    return 0;
+  }
+  memcpy(b->data + b->length, p, length);
+  b->length += length;
+  return 1;
+}
+
+static int buffer_byte(buffer *b, int byte)
+{
+  char c = byte;
+  return buffer_append(b, &c, 1);
+}
+
+// Drop the first length bytes.
+static void buffer_consume(buffer *b, size_t length)
+{
+  memmove(b->data, b->data + length, b->length - length);
+  b->length -= length;
+}
+
+static int huffman_decode(const uint8_t *p, size_t length, buffer *out)
+{
+  int node = 0;
+  // The bits read since the last symbol, which at the end must be padding of all ones.
+  int pending = 0;
+  int ones = 1;
+  for (size_t i = 0; i < length; i++)
+  {
+    for (int bit = 7; bit >= 0; bit--)
+    {
+      int b = (p[i] >> bit) & 1;
+      node = huffman_tree[node][b];
+      if (node < 0)
+      {
+        int symbol = -node - 1;
+        if (symbol == 256 || !buffer_byte(out, symbol))
+        {
+          return 0;
+        }
+        node = 0;
+        pending = 0;
+        ones = 1;
+      }
+      else
+      {
+        pending++;
+        ones &= b;
+      }
+    }
+  }
+  return pending < 8 && ones;
+}
+
+static size_t huffman_length(const uint8_t *p, size_t length)
+{
+  size_t bits = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    bits += huffman_lengths[p[i]];
+  }
+  return (bits + 7) / 8;
+}
+
+static int huffman_encode(const uint8_t *p, size_t length, buffer *out)
+{
+  uint64_t bits = 0;
+  int count = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    bits = (bits << huffman_lengths[p[i]]) | huffman_codes[p[i]];
+    count += huffman_lengths[p[i]];
+    while (count >= 8)
+    {
+      count -= 8;
+      if (!buffer_byte(out, (bits >> count) & 0xff))
+      {
+        return 0;
+      }
+    }
+  }
+  if (count > 0)
+  {
+    // Pad the last byte with the most significant bits of the end of string code.
+    return buffer_byte(out, ((bits << (8 - count)) | (0xff >> count)) & 0xff);
+  }
+  return 1;
+}
+
+// An integer with an N bit prefix. The other bits of the first byte are in first.
+static int encode_integer(buffer *out, int first, int prefix, uint64_t value)
+{
+  uint64_t max = (1 << prefix) - 1;
+  if (value < max)
+  {
+    return buffer_byte(out, first | value);
+  }
+  if (!buffer_byte(out, first | max))
+  {
+    return 0;
+  }
+  value -= max;
+  while (value >= 128)
+  {
+    if (!buffer_byte(out, (value & 127) | 128))
+    {
+      return 0;
+    }
+    value >>= 7;
+  }
+  return buffer_byte(out, value);
+}
+
+static int decode_integer(const uint8_t **p, const uint8_t *end, int prefix,
+  uint64_t *value)
+{
+  uint64_t max = (1 << prefix) - 1;
+  *value = *(*p)++ & max;
+  if (*value < max)
+  {
+    return 1;
+  }
+  for (int shift = 0; shift <= 28; shift += 7)
+  {
+    if (*p == end)
+    {
+      return 0;
+    }
+    uint8_t b = *(*p)++;
+    *value += (uint64_t)(b & 127) << shift;
+    if (!(b & 128))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Encode a string literal, with Huffman coding when that makes it shorter.
+static int encode_string(buffer *out, const char *s, size_t length)
+{
+  size_t huffman = huffman_length((const uint8_t*)s, length);
+  if (huffman < length)
+  {
+    return encode_integer(out, 0x80, 7, huffman)
+      && huffman_encode((const uint8_t*)s, length, out);
+  }
+  return encode_integer(out, 0, 7, length) && buffer_append(out, s, length);
+}
+
+// Decode a string literal to the end of out.
+static int decode_string(const uint8_t **p, const uint8_t *end, buffer *out)
+{
+  if (*p == end)
+  {
+    return 0;
+  }
+  int huffman = **p & 0x80;
+  uint64_t length;
+  if (!decode_integer(p, end, 7, &length) || length > (uint64_t)(end - *p))
+  {
+    return 0;
+  }
+  const uint8_t *s = *p;
+  *p += length;
+  return huffman ? huffman_decode(s, length, out) : buffer_append(out, s, length);
+}
+
+/*
+The dynamic table of HPACK as a ring of entries, the newest first. The size of an entry is
+the length of its name and value plus 32.
+*/
+typedef struct table_entry
+{
+  char *name;
+  size_t name_length;
+  // The value follows the name in the same allocation.
+  char *value;
+  size_t value_length;
+} table_entry;
+
+typedef struct header_table
+{
+  table_entry *entries;
+  size_t capacity;
+  size_t first;
+  size_t count;
+  size_t size;
+  size_t max_size;
+} header_table;
+
+static table_entry* table_get(header_table *t, size_t i)
+{
+  return &t->entries[(t->first + i) % t->capacity];
+}
+
+static void table_evict(header_table *t, size_t needed)
+{
+  while (t->count > 0 && t->size + needed > t->max_size)
+  {
+    table_entry *e = table_get(t, t->count - 1);
+    t->size -= e->name_length + e->value_length + 32;
+    free(e->name);
+    t->count--;
+  }
+}
+
+static int table_add(header_table *t, const char *name, size_t name_length,
+  const char *value, size_t value_length)
+{
+  size_t size = name_length + value_length + 32;
+  table_evict(t, size);
+  if (size > t->max_size)
+  {
+    // An entry larger than the table empties it and is not added.
+    return 1;
+  }
+  if (t->count == t->capacity)
+  {
+    size_t capacity = t->capacity ? t->capacity * 2 : 16;
+    table_entry *entries = malloc(capacity * sizeof(table_entry));
+    if (!entries)
+    {
+      return 0;
+    }
+    for (size_t i = 0; i < t->count; i++)
+    {
+      entries[i] = *table_get(t, i);
+    }
+    free(t->entries);
+    t->entries = entries;
+    t->capacity = capacity;
+    t->first = 0;
+  }
+  char *p = malloc(name_length + value_length + 1);
+  if (!p)
+  {
+    return 0;
+  }
+  memcpy(p, name, name_length);
+  memcpy(p + name_length, value, value_length);
+  t->first = (t->first + t->capacity - 1) % t->capacity;
+  t->count++;
+  t->size += size;
+  table_entry *e = table_get(t, 0);
+  e->name = p;
+  e->name_length = name_length;
+  e->value = p + name_length;
+  e->value_length = value_length;
+  return 1;
+}
+
+static void table_free(header_table *t)
+{
+  table_evict(t, t->max_size + 1);
+  free(t->entries);
+}
+
+// Look up an index of the static table or, from 62, the dynamic table.
+static int table_lookup(header_table *t, uint64_t index, const char **name,
+  size_t *name_length, const char **value, size_t *value_length)
+{
+  if (index >= 1 && index <= 61)
+  {
+    *name = static_table[index - 1][0];
+    *name_length = strlen(*name);
+    *value = static_table[index - 1][1];
+    *value_length = strlen(*value);
+    return 1;
+  }
+  if (index >= 62 && index - 62 < t->count)
+  {
+    table_entry *e = table_get(t, index - 62);
+    *name = e->name;
+    *name_length = e->name_length;
+    *value = e->value;
+    *value_length = e->value_length;
+    return 1;
+  }
+  return 0;
+}
+
+/*
+Find the index of a field in both tables. Return the index of the whole field in
+*full or else of an entry with the same name in *named, or 0.
+*/
+static void table_find(header_table *t, const char *name, size_t name_length,
+  const char *value, size_t value_length, size_t *full, size_t *named)
+{
+  *full = 0;
+  *named = 0;
+  for (size_t i = 0; i < 61; i++)
+  {
+    const char *n = static_table[i][0];
+    if (strlen(n) == name_length && memcmp(n, name, name_length) == 0)
+    {
+      const char *v = static_table[i][1];
+      if (strlen(v) == value_length && memcmp(v, value, value_length) == 0)
+      {
+        *full = i + 1;
+        return;
+      }
+      if (!*named)
+      {
+        *named = i + 1;
+      }
+    }
+  }
+  for (size_t i = 0; i < t->count; i++)
+  {
+    table_entry *e = table_get(t, i);
+    if (e->name_length == name_length && memcmp(e->name, name, name_length) == 0)
+    {
+      if (e->value_length == value_length && memcmp(e->value, value, value_length) == 0)
+      {
+        *full = i + 62;
+        return;
+      }
+      if (!*named)
+      {
+        *named = i + 62;
+      }
+    }
+  }
+}
+
+// The send window of a stream the client opened.
+typedef struct stream
+{
+  uint32_t id;
+  int64_t window;
+  // A stream file writes the response.
+  int open;
+  // END_STREAM was sent.
+  int ended;
+  // RST_STREAM was sent or received.
+  int reset;
+  // DATA waiting for the window to open, from queued.data + sent.
+  buffer queued;
+  size_t sent;
+  // END_STREAM follows the queued data.
+  int end_queued;
+} stream;
+
+/*
+A connection. The userdata and each open stream file hold a reference, so the last one
+closed frees it. The Lua files of the connection own the streams in and out, which are
+forgotten when h2.lua closes the connection.
+*/
+typedef struct connection
+{
+  FILE *in;
+  FILE *out;
+  // The socket, which is nonblocking during fill().
+  int fd;
+  int refs;
+  // A read or write failed or the connection is closed. No more frames are written.
+  int broken;
+  // Bytes read but not yet returned as frames.
+  buffer input;
+  // Whole frames that a blocked write read and set aside.
+  buffer pending;
+  buffer scratch;
+  header_table decoder;
+  header_table encoder;
+  // The client made the table of the encoder smaller. The next block says so.
+  int encoder_resized;
+  // The send window of the connection and the settings of the client.
+  int64_t window;
+  uint32_t initial_window;
+  uint32_t max_frame;
+  uint32_t last_stream_id;
+  // DATA bytes h2.lua took that the connection window has not been given back.
+  uint32_t consumed;
+  stream *streams;
+  size_t num_streams;
+  size_t streams_capacity;
+} connection;
+
+typedef struct connection_handle
+{
+  connection *c;
+} connection_handle;
+
+static void release(connection *c)
+{
+  if (--c->refs > 0)
+  {
+    return;
+  }
+  free(c->input.data);
+  free(c->pending.data);
+  free(c->scratch.data);
+  table_free(&c->decoder);
+  table_free(&c->encoder);
+  for (size_t i = 0; i < c->num_streams; i++)
+  {
+    free(c->streams[i].queued.data);
+  }
+  free(c->streams);
+  free(c);
+}
+
+static stream* find_stream(connection *c, uint32_t id)
+{
+  for (size_t i = 0; i < c->num_streams; i++)
+  {
+    if (c->streams[i].id == id)
+    {
+      return &c->streams[i];
+    }
+  }
+  return NULL;
+}
+
+static stream* add_stream(connection *c, uint32_t id)
+{
+  if (c->num_streams == c->streams_capacity)
+  {
+    size_t capacity = c->streams_capacity ? c->streams_capacity * 2 : 8;
+    stream *streams = realloc(c->streams, capacity * sizeof(stream));
+    if (!streams)
+    {
+      return NULL;
+    }
+    c->streams = streams;
+    c->streams_capacity = capacity;
+  }
+  stream *s = &c->streams[c->num_streams++];
+  memset(s, 0, sizeof(stream));
+  s->id = id;
+  s->window = c->initial_window;
+  return s;
+}
+
+static void remove_stream(connection *c, uint32_t id)
+{
+  stream *s = find_stream(c, id);
+  if (s)
+  {
+    free(s->queued.data);
+    *s = c->streams[--c->num_streams];
+  }
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+  p[0] = value >> 24;
+  p[1] = value >> 16;
+  p[2] = value >> 8;
+  p[3] = value;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+// Buffer a frame in the write stream of the connection.
+static int write_frame(connection *c, int type, int flags, uint32_t id,
+  const void *payload, size_t length)
+{
+  if (c->broken)
+  {
+    return 0;
+  }
+  uint8_t header[9];
+  header[0] = length >> 16;
+  header[1] = length >> 8;
+  header[2] = length;
+  header[3] = type;
+  header[4] = flags;
+  put32(header + 5, id & 0x7fffffff);
+  if (fwrite(header, 1, 9, c->out) != 9
+    || (length > 0 && fwrite(payload, 1, length, c->out) != length))
+  {
+    c->broken = 1;
+    return 0;
+  }
+  return 1;
+}
+
+static int write_u32_frame(connection *c, int type, uint32_t id, uint32_t value)
+{
+  uint8_t payload[4];
+  put32(payload, value);
+  return write_frame(c, type, 0, id, payload, 4);
+}
+
+static int write_goaway(connection *c, uint32_t code)
+{
+  uint8_t payload[8];
+  put32(payload, c->last_stream_id);
+  put32(payload + 4, code);
+  return write_frame(c, GOAWAY, 0, 0, payload, 8);
+}
+
+typedef struct frame
+{
+  int type;
+  int flags;
+  uint32_t id;
+  const uint8_t *payload;
+  size_t length;
+} frame;
+
+/*
+Parse the frame at the start of b. Return 1 for a whole frame, 0 if more bytes are needed,
+or -1 for a frame larger than the server allows.
+*/
+static int parse_frame(buffer *b, frame *f)
+{
+  if (b->length < 9)
+  {
+    return 0;
+  }
+  const uint8_t *p = (const uint8_t*)b->data;
+  f->length = (size_t)p[0] << 16 | p[1] << 8 | p[2];
+  if (f->length > MAX_FRAME)
+  {
+    return -1;
+  }
+  if (b->length < 9 + f->length)
+  {
+    return 0;
+  }
+  f->type = p[3];
+  f->flags = p[4];
+  f->id = get32(p + 5) & 0x7fffffff;
+  f->payload = p + 9;
+  return 1;
+}
+
+// Send RST_STREAM. A stream whose file is still open is removed once the file is closed.
+static int reset_stream(connection *c, uint32_t id, uint32_t code)
+{
+  stream *s = find_stream(c, id);
+  if (s && s->open)
+  {
+    s->reset = 1;
+  }
+  else if (s)
+  {
+    remove_stream(c, id);
+  }
+  return write_u32_frame(c, RST_STREAM, id, code);
+}
+
+/*
+Send the data a stream has queued as far as the flow control windows of the client allow,
+and END_STREAM after it if the stream file was closed.
+*/
+static void drain(connection *c, stream *s)
+{
+  size_t length = s->queued.length - s->sent;
+  while (!s->reset && !s->ended && (length > 0 || s->end_queued))
+  {
+    int64_t allowed = length;
+    allowed = allowed < c->max_frame ? allowed : c->max_frame;
+    allowed = allowed < c->window ? allowed : c->window;
+    allowed = allowed < s->window ? allowed : s->window;
+    if (length > 0 && allowed <= 0)
+    {
+      return;
+    }
+    int last = (size_t)allowed == length;
+    if (!write_frame(c, DATA, last && s->end_queued ? END_STREAM : 0, s->id,
+      s->queued.data + s->sent, allowed))
+    {
+      return;
+    }
+    c->window -= allowed;
+    s->window -= allowed;
+    s->sent += allowed;
+    length -= allowed;
+    s->ended = last && s->end_queued;
+  }
+  if (length == 0)
+  {
+    s->queued.length = 0;
+    s->sent = 0;
+  }
+}
+
+/*
+Drain the streams after a window opened. A stream whose file was closed with data still
+queued is forgotten once the data and END_STREAM are sent.
+*/
+static void drain_streams(connection *c)
+{
+  size_t i = 0;
+  while (i < c->num_streams)
+  {
+    stream *s = &c->streams[i];
+    drain(c, s);
+    if (!s->open && s->end_queued && s->ended)
+    {
+      remove_stream(c, s->id);
+    }
+    else
+    {
+      i++;
+    }
+  }
+}
+
+// Queue data of a stream until the window of the client opens.
+static int queue_data(connection *c, stream *s, const char *p, size_t length, int end)
+{
+  if (s->sent > s->queued.length / 2)
+  {
+    buffer_consume(&s->queued, s->sent);
+    s->sent = 0;
+  }
+  if (s->queued.length - s->sent + length > MAX_QUEUED
+    || !buffer_append(&s->queued, p, length))
+  {
+    // The client is not reading the response.
+    reset_stream(c, s->id, CANCEL);
+    return -1;
+  }
+  s->end_queued = end;
+  return 0;
+}
+
+/*
+Handle the frames that only concern the connection and record the streams that HEADERS
+opens and RST_STREAM closes. Return 1 if the frame was handled here, 0 if h2.lua should
+see it, or the error code of the connection plus one.
+
+A WINDOW_UPDATE that breaks the rules for a stream resets only that stream. The frame,
+which is still in c->input, is turned into an RST_STREAM with the same error code, so
+h2.lua forgets the stream as if the client had reset it.
+*/
+static int control(connection *c, frame *f)
+{
+  switch (f->type)
+  {
+  case SETTINGS:
+    if (f->id != 0)
+    {
+      return PROTOCOL_ERROR + 1;
+    }
+    if (f->flags & ACK)
+    {
+      return f->length == 0 ? 1 : FRAME_SIZE_ERROR + 1;
+    }
+    if (f->length % 6 != 0)
+    {
+      return FRAME_SIZE_ERROR + 1;
+    }
+    for (size_t i = 0; i < f->length; i += 6)
+    {
+      int id = f->payload[i] << 8 | f->payload[i + 1];
+      uint32_t value = get32(f->payload + i + 2);
+      if (id == 0x1)
+      {
+        // SETTINGS_HEADER_TABLE_SIZE
+        size_t size = value < HEADER_TABLE_SIZE ? value : HEADER_TABLE_SIZE;
+        if (size != c->encoder.max_size)
+        {
+          c->encoder.max_size = size;
+          table_evict(&c->encoder, 0);
+          c->encoder_resized = 1;
+        }
+      }
+      else if (id == 0x4)
+      {
+        // SETTINGS_INITIAL_WINDOW_SIZE changes the window of every open stream.
+        if (value > MAX_WINDOW)
+        {
+          return FLOW_CONTROL_ERROR + 1;
+        }
+        int64_t delta = (int64_t)value - c->initial_window;
+        for (size_t j = 0; j < c->num_streams; j++)
+        {
+          c->streams[j].window += delta;
+        }
+        c->initial_window = value;
+        drain_streams(c);
+      }
+      else if (id == 0x5)
+      {
+        // SETTINGS_MAX_FRAME_SIZE
+        if (value < 16384 || value > 16777215)
+        {
+          return PROTOCOL_ERROR + 1;
+        }
+        c->max_frame = value;
+      }
+    }
+    write_frame(c, SETTINGS, ACK, 0, NULL, 0);
+    return 1;
+  case PING:
+    if (f->id != 0)
+    {
+      return PROTOCOL_ERROR + 1;
+    }
+    if (f->length != 8)
+    {
+      return FRAME_SIZE_ERROR + 1;
+    }
+    if (!(f->flags & ACK))
+    {
+      write_frame(c, PING, ACK, 0, f->payload, 8);
+    }
+    return 1;
+  case WINDOW_UPDATE:
+  {
+    if (f->length != 4)
+    {
+      return FRAME_SIZE_ERROR + 1;
+    }
+    uint32_t increment = get32(f->payload) & 0x7fffffff;
+    if (f->id == 0)
+    {
+      if (increment == 0 || c->window + increment > MAX_WINDOW)
+      {
+        return (increment ? FLOW_CONTROL_ERROR : PROTOCOL_ERROR) + 1;
+      }
+      c->window += increment;
+    }
+    else
+    {
+      // A closed stream may still get a WINDOW_UPDATE sent before the client knew.
+      stream *s = find_stream(c, f->id);
+      if (s && (increment == 0 || s->window + increment > MAX_WINDOW))
+      {
+        uint32_t code = increment ? FLOW_CONTROL_ERROR : PROTOCOL_ERROR;
+        reset_stream(c, f->id, code);
+        uint8_t *p = (uint8_t*)f->payload;
+        p[-6] = RST_STREAM;
+        put32(p, code);
+        f->type = RST_STREAM;
+        return 0;
+      }
+      if (s)
+      {
+        s->window += increment;
+      }
+    }
+    drain_streams(c);
+    return 1;
+  }
+  case HEADERS:
+    if (f->id > c->last_stream_id && f->id & 1)
+    {
+      if (!add_stream(c, f->id))
+      {
+        return PROTOCOL_ERROR + 1;
+      }
+      c->last_stream_id = f->id;
+    }
+    return 0;
+  case RST_STREAM:
+  {
+    stream *s = find_stream(c, f->id);
+    if (s && s->open)
+    {
+      s->reset = 1;
+    }
+    else if (s)
+    {
+      remove_stream(c, f->id);
+    }
+    return 0;
+  }
+  default:
+    return 0;
+  }
+}
+
+/*
+Flush the frames written so far and read one more frame while a write waits for the
+client to open its flow control window. The read blocks like the read of a request, for at
+most SO_RCVTIMEO. Return 0, 1 if nothing came in time, or -1 when the connection is
+broken.
+*/
+static int read_one_frame(connection *c)
+{
+  if (c->broken || fflush(c->out) != 0)
+  {
+    c->broken = 1;
+    return -1;
+  }
+  frame f;
+  int ret;
+  while ((ret = parse_frame(&c->input, &f)) == 0)
+  {
+    size_t need = c->input.length < 9 ? 9 - c->input.length
+      : 9 + ((size_t)(uint8_t)c->input.data[0] << 16
+      | (uint8_t)c->input.data[1] << 8 | (uint8_t)c->input.data[2]) - c->input.length;
+    if (!buffer_reserve(&c->input, need))
+    {
+      c->broken = 1;
+      return -1;
+    }
+    size_t count = fread(c->input.data + c->input.length, 1, need, c->in);
+    int err = errno;
+    c->input.length += count;
+    if (count == 0)
+    {
+      int timeout = ferror(c->in) && (err == EAGAIN || err == EWOULDBLOCK);
+      clearerr(c->in);
+      if (timeout)
+      {
+        return 1;
+      }
+      c->broken = 1;
+      return -1;
+    }
+  }
+  int code = ret < 0 ? FRAME_SIZE_ERROR + 1 : control(c, &f);
+  if (code == 0 && !buffer_append(&c->pending, c->input.data, 9 + f.length))
+  {
+    c->broken = 1;
+    return -1;
+  }
+  if (code > 1)
+  {
+    write_goaway(c, code - 1);
+    fflush(c->out);
+    c->broken = 1;
+    return -1;
+  }
+  buffer_consume(&c->input, 9 + f.length);
+  return 0;
+}
+
+/*
+Write DATA frames as far as the flow control windows of the client allow, reading frames
+while they are closed. Once they stay closed for SO_RCVTIMEO the rest is queued, and so
+are the writes after it while the queue is below MAX_QUEUED. With end set the last frame
+ends the stream.
+*/
+static int send_data(connection *c, uint32_t id, const char *p, size_t length, int end)
+{
+  while (1)
+  {
+    stream *s = find_stream(c, id);
+    if (c->broken || !s || s->reset)
+    {
+      return -1;
+    }
+    int64_t allowed = length;
+    allowed = allowed < c->max_frame ? allowed : c->max_frame;
+    allowed = allowed < c->window ? allowed : c->window;
+    allowed = allowed < s->window ? allowed : s->window;
+    if (allowed < 0)
+    {
+      allowed = 0;
+    }
+    if (s->queued.length > 0 && s->queued.length - s->sent + length <= MAX_QUEUED)
+    {
+      // The data goes after what is queued.
+      return queue_data(c, s, p, length, end);
+    }
+    if (s->queued.length > 0 || (length > 0 && allowed == 0))
+    {
+      int ret = read_one_frame(c);
+      if (ret < 0)
+      {
+        return -1;
+      }
+      s = find_stream(c, id);
+      if (ret > 0 && s && !s->reset)
+      {
+        // The frame that opens the window is read by h2.lua from the event loop.
+        return queue_data(c, s, p, length, end);
+      }
+      continue;
+    }
+    int last = (size_t)allowed == length;
+    if (!write_frame(c, DATA, last && end ? END_STREAM : 0, id, p, allowed))
+    {
+      return -1;
+    }
+    c->window -= allowed;
+    s->window -= allowed;
+    p += allowed;
+    length -= allowed;
+    if (last)
+    {
+      s->ended = end;
+      return 0;
+    }
+  }
+}
+
+/*
+The response of a stream. A write flushes the connection at once because a servlet that
+flushes its own stream expects the client to see the data.
+*/
+typedef struct stream_writer
+{
+  connection *c;
+  uint32_t id;
+} stream_writer;
+
+static ssize_t stream_write(void *cookie, const char *buffer, size_t size)
+{
+  stream_writer *w = cookie;
+  connection *c = w->c;
+  stream *s = find_stream(c, w->id);
+  if (s && s->ended && !s->reset)
+  {
+    // The headers ended the stream, as for HEAD.
+    return size;
+  }
+  if (send_data(c, w->id, buffer, size, 0) < 0 || fflush(c->out) != 0)
+  {
+    errno = EPIPE;
+    return -1;
+  }
+  return size;
+}
+
+static int stream_close(void *cookie)
+{
+  stream_writer *w = cookie;
+  connection *c = w->c;
+  stream *s = find_stream(c, w->id);
+  int ret = 0;
+  if (s && !s->ended && !s->reset)
+  {
+    if (send_data(c, w->id, NULL, 0, 1) < 0 || fflush(c->out) != 0)
+    {
+      ret = EOF;
+    }
+  }
+  s = find_stream(c, w->id);
+  if (s && s->end_queued && !s->ended && !s->reset)
+  {
+    // drain_streams() forgets the stream once the queue is sent.
+    s->open = 0;
+  }
+  else
+  {
+    remove_stream(c, w->id);
+  }
+  release(c);
+  free(w);
+  return ret;
+}
+
+/*
+Replace the stream of a Lua file with f. The file is made by io.open() so that it works
+with every Lua version, as in cutil.fdopen().
+*/
+static int push_file(lua_State *l, FILE *f, const char *mode)
+{
+  lua_getglobal(l, "io");
+  lua_getfield(l, -1, "open");
+  lua_pushliteral(l, "/dev/null");
+  lua_pushstring(l, mode);
+  lua_call(l, 2, 1);
+  luaL_Stream *stream = luaL_testudata(l, -1, LUA_FILEHANDLE);
+  lua_remove(l, -2);
+  if (!stream)
+  {
+    fclose(f);
+    return 0;
+  }
+  fclose(stream->f);
+  stream->f = f;
+  return 1;
+}
+
+static connection* check_connection(lua_State *l)
+{
+  connection_handle *handle = luaL_checkudata(l, 1, CONNECTION);
+  luaL_argcheck(l, handle->c != NULL, 1, "connection is closed");
+  return handle->c;
+}
+
+/*
+ch2.connection(read_file, write_file, fd) returns a connection over the streams of an
+accepted connection whose preface was read. fd is the socket, for fill().
+*/
+static int ch2_connection(lua_State *l)
+{
+  luaL_Stream *in = luaL_checkudata(l, 1, LUA_FILEHANDLE);
+  luaL_Stream *out = luaL_checkudata(l, 2, LUA_FILEHANDLE);
+  int fd = luaL_optinteger(l, 3, -1);
+  connection_handle *handle = lua_newuserdata(l, sizeof(connection_handle));
+  handle->c = calloc(1, sizeof(connection));
+  if (!handle->c)
+  {
+    return luaL_error(l, "%s", strerror(ENOMEM));
+  }
+  luaL_setmetatable(l, CONNECTION);
+  connection *c = handle->c;
+  c->in = in->f;
+  c->out = out->f;
+  c->fd = fd;
+  c->refs = 1;
+  c->decoder.max_size = HEADER_TABLE_SIZE;
+  c->encoder.max_size = HEADER_TABLE_SIZE;
+  c->window = DEFAULT_WINDOW;
+  c->initial_window = DEFAULT_WINDOW;
+  c->max_frame = 16384;
+  return 1;
+}
+
+// Write the SETTINGS frame that starts the connection and open the receive window.
+static int connection_preface(lua_State *l)
+{
+  connection *c = check_connection(l);
+  uint8_t settings[18];
+  const uint32_t values[3][2] = {
+    {0x2, 0}, // SETTINGS_ENABLE_PUSH
+    {0x3, MAX_CONCURRENT_STREAMS},
+    {0x4, STREAM_WINDOW}, // SETTINGS_INITIAL_WINDOW_SIZE
+  };
+  for (int i = 0; i < 3; i++)
+  {
+    settings[i * 6] = 0;
+    settings[i * 6 + 1] = values[i][0];
+    put32(settings + i * 6 + 2, values[i][1]);
+  }
+  lua_pushboolean(l, write_frame(c, SETTINGS, 0, 0, settings, sizeof(settings))
+    && write_u32_frame(c, WINDOW_UPDATE, 0, CONNECTION_WINDOW - DEFAULT_WINDOW));
+  return 1;
+}
+
+/*
+connection:fill() reads what the client has sent without blocking. It returns the number
+of bytes read, which is 0 if there was nothing to read, or nil and an error message once
+the client has closed the connection.
+*/
+static int connection_fill(lua_State *l)
+{
+  connection *c = check_connection(l);
+  if (c->broken)
+  {
+    lua_pushnil(l);
+    lua_pushliteral(l, "EOF");
+    return 2;
+  }
+  int flags = fcntl(c->fd, F_GETFL);
+  if (flags == -1 || fcntl(c->fd, F_SETFL, flags | O_NONBLOCK) == -1)
+  {
+    lua_pushnil(l);
+    lua_pushstring(l, strerror(errno));
+    return 2;
+  }
+  // Read at most this much before the frames are handled.
+  const size_t limit = 262144;
+  size_t total = 0;
+  while (total < limit && buffer_reserve(&c->input, 16384))
+  {
+    size_t available = c->input.capacity - c->input.length;
+    size_t count = fread(c->input.data + c->input.length, 1, available, c->in);
+    c->input.length += count;
+    total += count;
+    if (count < available)
+    {
+      break;
+    }
+  }
+  int err = errno;
+  int eof = feof(c->in);
+  int error = ferror(c->in) && err != EAGAIN && err != EWOULDBLOCK;
+  clearerr(c->in);
+  fcntl(c->fd, F_SETFL, flags);
+  if (total == 0 && (eof || error))
+  {
+    lua_pushnil(l);
+    lua_pushstring(l, eof ? "EOF" : strerror(err));
+    return 2;
+  }
+  lua_pushinteger(l, total);
+  return 1;
+}
+
+/*
+connection:frame() returns the type, flags, stream id, and payload of the next frame for
+h2.lua, and for DATA the length that counts against flow control. The padding and the
+priority fields are removed. It returns nil if no whole frame has been read, or false and
+an error code if the client broke the protocol.
+*/
+static int connection_frame(lua_State *l)
+{
+  connection *c = check_connection(l);
+  while (1)
+  {
+    frame f;
+    buffer *b = &c->pending;
+    int ret = parse_frame(b, &f);
+    if (ret == 0 && !c->broken)
+    {
+      b = &c->input;
+      ret = parse_frame(b, &f);
+      if (ret > 0)
+      {
+        ret = control(c, &f);
+        if (ret == 1)
+        {
+          buffer_consume(b, 9 + f.length);
+          continue;
+        }
+        ret = ret == 0 ? 1 : -ret;
+      }
+      else if (ret < 0)
+      {
+        ret = -(FRAME_SIZE_ERROR + 1);
+      }
+    }
+    if (ret == 0)
+    {
+      return 0;
+    }
+    if (ret < 0)
+    {
+      lua_pushboolean(l, 0);
+      lua_pushinteger(l, -ret - 1);
+      return 2;
+    }
+    const uint8_t *payload = f.payload;
+    size_t length = f.length;
+    if ((f.type == DATA || f.type == HEADERS) && f.flags & PADDED)
+    {
+      if (length < 1 || payload[0] >= length)
+      {
+        lua_pushboolean(l, 0);
+        lua_pushinteger(l, PROTOCOL_ERROR);
+        return 2;
+      }
+      length -= 1 + payload[0];
+      payload++;
+    }
+    if (f.type == HEADERS && f.flags & PRIORITY_FLAG)
+    {
+      if (length < 5)
+      {
+        lua_pushboolean(l, 0);
+        lua_pushinteger(l, FRAME_SIZE_ERROR);
+        return 2;
+      }
+      length -= 5;
+      payload += 5;
+    }
+    lua_pushinteger(l, f.type);
+    lua_pushinteger(l, f.flags);
+    lua_pushinteger(l, f.id);
+    lua_pushlstring(l, (const char*)payload, length);
+    lua_pushinteger(l, f.length);
+    buffer_consume(b, 9 + f.length);
+    if (f.type == DATA)
+    {
+      // Give the window of the connection back in large steps.
+      c->consumed += f.length;
+      if (c->consumed >= CONNECTION_WINDOW / 2)
+      {
+        write_u32_frame(c, WINDOW_UPDATE, 0, c->consumed);
+        c->consumed = 0;
+      }
+    }
+    return 5;
+  }
+}
+
+/*
+connection:decode(block) returns the fields of a header block as a list of names and
+values, {name1, value1, name2, value2, ...}. It returns nil and an error message if the
+block is not valid, after which the tables of the two ends may differ and the connection
+must be closed with COMPRESSION_ERROR.
+*/
+static int connection_decode(lua_State *l)
+{
+  connection *c = check_connection(l);
+  size_t length;
+  const uint8_t *p = (const uint8_t*)luaL_checklstring(l, 2, &length);
+  const uint8_t *end = p + length;
+  header_table *t = &c->decoder;
+  buffer *b = &c->scratch;
+  size_t list_size = 0;
+  int n = 0;
+  // Every break below leaves the loop on an invalid block.
+  int valid = 0;
+  lua_newtable(l);
+  while (1)
+  {
+    if (p == end)
+    {
+      valid = 1;
+      break;
+    }
+    uint64_t index;
+    const char *name;
+    const char *value;
+    size_t name_length;
+    size_t value_length;
+    int indexing = 0;
+    b->length = 0;
+    if (*p & 0x80)
+    {
+      // An indexed field.
+      if (!decode_integer(&p, end, 7, &index)
+        || !table_lookup(t, index, &name, &name_length, &value, &value_length))
+      {
+        break;
+      }
+    }
+    else if ((*p & 0xe0) == 0x20)
+    {
+      // A dynamic table size update.
+      if (!decode_integer(&p, end, 5, &index) || index > HEADER_TABLE_SIZE)
+      {
+        break;
+      }
+      t->max_size = index;
+      table_evict(t, 0);
+      continue;
+    }
+    else
+    {
+      // A literal field, added to the table or not.
+      indexing = *p & 0x40;
+      if (!decode_integer(&p, end, indexing ? 6 : 4, &index))
+      {
+        break;
+      }
+      if (index)
+      {
+        if (!table_lookup(t, index, &name, &name_length, &value, &value_length)
+          || !buffer_append(b, name, name_length))
+        {
+          break;
+        }
+      }
+      else if (!decode_string(&p, end, b))
+      {
+        break;
+      }
+      size_t value_offset = b->length;
+      if (!decode_string(&p, end, b))
+      {
+        break;
+      }
+      name = b->data;
+      name_length = value_offset;
+      value = b->data + value_offset;
+      value_length = b->length - value_offset;
+    }
+    list_size += name_length + value_length + 32;
+    if (list_size > MAX_HEADER_LIST)
+    {
+      break;
+    }
+    lua_pushlstring(l, name, name_length);
+    lua_rawseti(l, -2, ++n);
+    lua_pushlstring(l, value, value_length);
+    lua_rawseti(l, -2, ++n);
+    if (indexing && !table_add(t, name, name_length, value, value_length))
+    {
+      break;
+    }
+  }
+  if (!valid)
+  {
+    lua_pushnil(l);
+    lua_pushliteral(l, "invalid header block");
+    return 2;
+  }
+  return 1;
+}
+
+/*
+Header fields whose values change with every response. They are sent without adding them
+to the dynamic table, where they would push out the fields that repeat.
+*/
+static int is_unique_field(const char *name, size_t length)
+{
+  return (length == 14 && memcmp(name, "content-length", 14) == 0)
+    || (length == 10 && memcmp(name, "set-cookie", 10) == 0);
+}
+
+/*
+connection:encode{name1, value1, name2, value2, ...} returns a header block. Names must be
+in lower case.
+*/
+static int connection_encode(lua_State *l)
+{
+  connection *c = check_connection(l);
+  luaL_checktype(l, 2, LUA_TTABLE);
+  header_table *t = &c->encoder;
+  buffer *b = &c->scratch;
+  b->length = 0;
+  int ok = 1;
+  if (c->encoder_resized)
+  {
+    ok = encode_integer(b, 0x20, 5, t->max_size);
+    c->encoder_resized = 0;
+  }
+  int count = lua_rawlen(l, 2);
+  for (int i = 1; ok && i < count; i += 2)
+  {
+    lua_rawgeti(l, 2, i);
+    lua_rawgeti(l, 2, i + 1);
+    size_t name_length;
+    size_t value_length;
+    const char *name = luaL_checklstring(l, -2, &name_length);
+    const char *value = luaL_checklstring(l, -1, &value_length);
+    size_t full;
+    size_t named;
+    table_find(t, name, name_length, value, value_length, &full, &named);
+    if (full)
+    {
+      ok = encode_integer(b, 0x80, 7, full);
+    }
+    else
+    {
+      int indexing = !is_unique_field(name, name_length);
+      ok = encode_integer(b, indexing ? 0x40 : 0, indexing ? 6 : 4, named)
+        && (named || encode_string(b, name, name_length))
+        && encode_string(b, value, value_length)
+        && (!indexing || table_add(t, name, name_length, value, value_length));
+    }
+    lua_pop(l, 2);
+  }
+  if (!ok)
+  {
+    return luaL_error(l, "%s", strerror(ENOMEM));
+  }
+  lua_pushlstring(l, b->data, b->length);
+  return 1;
+}
+
+/*
+connection:send_headers(id, block, end_stream) writes a header block in a HEADERS frame
+and as many CONTINUATION frames as it needs. With end_stream the response has no body.
+*/
+static int connection_send_headers(lua_State *l)
+{
+  connection *c = check_connection(l);
+  uint32_t id = luaL_checkinteger(l, 2);
+  size_t length;
+  const char *block = luaL_checklstring(l, 3, &length);
+  int end = lua_toboolean(l, 4);
+  int type = HEADERS;
+  int ok = 1;
+  do
+  {
+    size_t size = length < c->max_frame ? length : c->max_frame;
+    int flags = (size == length ? END_HEADERS : 0)
+      | (type == HEADERS && end ? END_STREAM : 0);
+    ok = write_frame(c, type, flags, id, block, size);
+    block += size;
+    length -= size;
+    type = CONTINUATION;
+  } while (ok && length > 0);
+  stream *s = find_stream(c, id);
+  if (s && end)
+  {
+    s->ended = 1;
+  }
+  if (!ok)
+  {
+    lua_pushnil(l);
+    lua_pushliteral(l, "connection is broken");
+    return 2;
+  }
+  lua_pushboolean(l, 1);
+  return 1;
+}
+
+/*
+connection:stream_file(id) returns a file whose writes become DATA frames of the stream.
+Closing the file ends the stream.
+*/
+static int connection_stream_file(lua_State *l)
+{
+  connection *c = check_connection(l);
+  uint32_t id = luaL_checkinteger(l, 2);
+  stream *s = find_stream(c, id);
+  stream_writer *w = malloc(sizeof(stream_writer));
+  if (!s || !w)
+  {
+    free(w);
+    return luaL_error(l, "no open stream %d", (int)id);
+  }
+  w->c = c;
+  w->id = id;
+  cookie_io_functions_t functions = {
+    .read = NULL,
+    .write = stream_write,
+    .seek = NULL,
+    .close = stream_close,
+  };
+  FILE *f = fopencookie(w, "w", functions);
+  if (!f)
+  {
+    free(w);
+    return luaL_error(l, "%s", strerror(errno));
+  }
+  s->open = 1;
+  c->refs++;
+  // A full buffer and its frame header fill one TLS record of 16 KB.
+  setvbuf(f, NULL, _IOFBF, MAX_FRAME - 9);
+  if (!push_file(l, f, "w"))
+  {
+    return luaL_error(l, "unable to make a Lua file");
+  }
+  return 1;
+}
+
+// connection:rst_stream(id, code) resets a stream.
+static int connection_rst_stream(lua_State *l)
+{
+  connection *c = check_connection(l);
+  uint32_t id = luaL_checkinteger(l, 2);
+  uint32_t code = luaL_optinteger(l, 3, NO_ERROR);
+  lua_pushboolean(l, reset_stream(c, id, code));
+  return 1;
+}
+
+/*
+connection:queued() returns the number of streams with response data that waits for the
+client to open its window. The connection stays open until it is sent.
+*/
+static int connection_queued(lua_State *l)
+{
+  connection *c = check_connection(l);
+  int count = 0;
+  for (size_t i = 0; i < c->num_streams; i++)
+  {
+    stream *s = &c->streams[i];
+    count += !s->reset && (s->queued.length > 0 || (s->end_queued && !s->ended));
+  }
+  lua_pushinteger(l, count);
+  return 1;
+}
+
+// connection:goaway(code) tells the client that no more streams are accepted.
+static int connection_goaway(lua_State *l)
+{
+  connection *c = check_connection(l);
+  lua_pushboolean(l, write_goaway(c, luaL_optinteger(l, 2, NO_ERROR)));
+  return 1;
+}
+
+// connection:window_update(id, increment) opens the receive window of a stream.
+static int connection_window_update(lua_State *l)
+{
+  connection *c = check_connection(l);
+  uint32_t id = luaL_checkinteger(l, 2);
+  uint32_t increment = luaL_checkinteger(l, 3);
+  lua_pushboolean(l, increment == 0 || write_u32_frame(c, WINDOW_UPDATE, id, increment));
+  return 1;
+}
+
+// connection:flush() sends the frames written so far. It returns false if that failed.
+static int connection_flush(lua_State *l)
+{
+  connection *c = check_connection(l);
+  if (!c->broken && fflush(c->out) != 0)
+  {
+    c->broken = 1;
+  }
+  lua_pushboolean(l, !c->broken);
+  return 1;
+}
+
+/*
+connection:close() forgets the streams of the connection before h2.lua closes its files.
+Stream files still open fail their writes.
+*/
+static int connection_close(lua_State *l)
+{
+  connection_handle *handle = luaL_checkudata(l, 1, CONNECTION);
+  if (handle->c)
+  {
+    handle->c->broken = 1;
+    handle->c->in = NULL;
+    handle->c->out = NULL;
+    release(handle->c);
+    handle->c = NULL;
+  }
+  return 0;
+}
+
+/*
+ch2.body_file(body) returns a file to read the body of a request from. The body is copied
+so the file is independent of the string.
+*/
+static int ch2_body_file(lua_State *l)
+{
+  size_t length;
+  const char *body = luaL_checklstring(l, 1, &length);
+  // A write stores a null byte after the data, so the buffer needs one more byte.
+  FILE *f = fmemopen(NULL, length + 1, "w+");
+  if (!f || fwrite(body, 1, length, f) != length)
+  {
+    if (f)
+    {
+      fclose(f);
+    }
+    return luaL_error(l, "%s", strerror(errno));
+  }
+  rewind(f);
+  if (!push_file(l, f, "r"))
+  {
+    return luaL_error(l, "unable to make a Lua file");
+  }
+  return 1;
+}
+
+static const luaL_Reg connection_methods[] =
+{
+  {"close", connection_close},
+  {"decode", connection_decode},
+  {"encode", connection_encode},
+  {"fill", connection_fill},
+  {"flush", connection_flush},
+  {"frame", connection_frame},
+  {"goaway", connection_goaway},
+  {"preface", connection_preface},
+  {"queued", connection_queued},
+  {"rst_stream", connection_rst_stream},
+  {"send_headers", connection_send_headers},
+  {"stream_file", connection_stream_file},
+  {"window_update", connection_window_update},
+  {NULL, NULL},
+};
+
+static const luaL_Reg ch2[] =
+{
+  {"body_file", ch2_body_file},
+  {"connection", ch2_connection},
+  {NULL, NULL},
+};
+
+LUALIB_API int luaopen_ch2(lua_State *l)
+{
+  if (huffman_tree[0][0] == 0)
+  {
+    build_huffman_tree();
+  }
+  luaL_newmetatable(l, CONNECTION);
+  luaL_newlib(l, connection_methods);
+  lua_setfield(l, -2, "__index");
+  lua_pushcfunction(l, connection_close);
+  lua_setfield(l, -2, "__gc");
+  lua_pop(l, 1);
+  luaL_newlib(l, ch2);
+  return 1;
+}
@@ -0,0 +1,524 @@
+--[[
+HTTP/2. A client that opens a connection with the HTTP/2 preface, in plain text with prior
+knowledge or after choosing h2 with ALPN in the TLS handshake, sends all of its requests
+over that one connection as streams. The connection stays open in the event loop of the
+child between requests, so a browser fetches every asset of a page from one child instead
+of opening six connections that hold six children.
+
+Each stream gets a servlet state like a request over HTTP/1.1. Its headers are written as
+a HEADERS frame and rwrite() writes DATA frames through clientfd_write, so servlets and
+modules run unchanged. The servlets of the streams run one after another as their
+requests arrive. A servlet that defers its request keeps its stream open while the other
+streams go on. Framing, flow control, and HPACK are in h2.c.
+
+The upgrade from HTTP/1.1 to h2c is not supported. RFC 9113 deprecates it and browsers
+never used it.
+--]]
+local h2 = {}
+
+local ch2 = require("ch2")
+local config = require("config")
+local cutil = require("cutil")
+local event = require("event")
+local http = require("http")
+local stdio = require("posix.stdio")
+local bit = bit32 or require("bit")
+
+-- Frame types, flags, and error codes.
+local DATA, HEADERS, RST_STREAM, PUSH_PROMISE, GOAWAY, CONTINUATION = 0, 1, 3, 5, 7, 9
+local END_STREAM, END_HEADERS = 0x1, 0x4
+local NO_ERROR, PROTOCOL_ERROR, INTERNAL_ERROR = 0x0, 0x1, 0x2
+local REFUSED_STREAM, COMPRESSION_ERROR, ENHANCE_YOUR_CALM = 0x7, 0x9, 0xb
+
+-- SETTINGS_MAX_CONCURRENT_STREAMS as h2.c advertises it.
+local MAX_STREAMS = 100
+-- The largest header block and request body of a stream. A larger body gets 413.
+local MAX_HEADER_BLOCK = 65536
+local MAX_BODY = 16 * 1024 * 1024
+
+local function has(flags, flag)
+  return bit.band(flags, flag) ~= 0
+end
+
+-- Fields about a single HTTP/1.1 connection, which HTTP/2 does not allow.
+local connection_fields = {
+  ["connection"] = true,
+  ["keep-alive"] = true,
+  ["proxy-connection"] = true,
+  ["transfer-encoding"] = true,
+  ["upgrade"] = true,
+}
+
+--[[
+Write the status and headers of a stream as a HEADERS frame. Called by
+api:write_status_line_and_headers(). A response to HEAD or with a Content-Length of 0 ends
+the stream with its headers.
+--]]
+function h2.write_headers(state)
+  local headers = state.response_headers
+  headers["server"], headers["date"] = nil, nil
+  local fields = {":status", tostring(state.status or 200), "server", "modserver",
+    "date", http.date()}
+  if not headers["content-type"] then
+    fields[7], fields[8] = "content-type", "text/html; charset=UTF-8"
+  end
+  for name, header in pairs(headers) do
+    if not connection_fields[name] then
+      -- A list of values, as for Set-Cookie, is sent as one field each like in HTTP/1.1.
+      local values = type(header.value) == "table" and header.value or {header.value}
+      for _, value in ipairs(values) do
+        fields[#fields + 1] = name
+        fields[#fields + 1] = tostring(value)
+      end
+    end
+  end
+  local length = headers["content-length"]
+  local empty = state:get_method() == "HEAD" or (length and tonumber(length.value) == 0)
+  local conn = state.h2.conn
+  assert(conn:send_headers(state.h2.id, conn:encode(fields), empty))
+  state.response_headers_written = true
+  state.response_body = empty and "none" or "identity"
+end
+
+-- Make the request table of a stream like the one read_and_parse_request() returns.
+local function make_request(fields)
+  local request = {version = "HTTP/2.0", headers = {}}
+  local authority
+  for i = 1, #fields, 2 do
+    local name, value = fields[i], fields[i + 1]
+    if name:sub(1, 1) == ":" then
+      if name == ":method" then
+        request.method = value
+      elseif name == ":path" then
+        request.uri = value
+      elseif name == ":authority" then
+        authority = value
+      end
+    else
+      local previous = request.headers[name]
+      if previous then
+        -- A cookie may be split into several fields. Other fields join as a list.
+        value = previous .. (name == "cookie" and "; " or ", ") .. value
+      end
+      request.headers[name] = value
+    end
+  end
+  request.headers["host"] = request.headers["host"] or authority
+  if not (request.method and request.uri) then
+    return nil
+  end
+  local uri_path, query_string = http.parse_uri(request.uri)
+  if not uri_path then
+    return nil
+  end
+  request.uri_path = uri_path
+  request.query = http.parse_query_string(query_string or "")
+  return request
+end
+
+--[[
+Count the streams whose request is arriving, whose servlet deferred the response, or whose
+response waits for the client to open its flow control window.
+--]]
+local function open_streams(session)
+  local count = session.conn:queued()
+  for id, stream in pairs(session.deferred) do
+    if stream.finished then
+      session.deferred[id] = nil
+    else
+      count = count + 1
+    end
+  end
+  for _ in pairs(session.receiving) do
+    count = count + 1
+  end
+  return count
+end
+
+--[[
+The end_response of the connection, called by event.finish(). Finish the deferred streams
+first because their files write to the connection.
+--]]
+local function close(state)
+  local session = state.http2
+  for _, stream in pairs(session.deferred) do
+    event.finish(stream)
+  end
+  if not session.goaway_sent then
+    session.conn:goaway(NO_ERROR)
+  end
+  session.conn:flush()
+  session.conn:close()
+end
+
+local function connection_error(state, code)
+  state.http2.conn:goaway(code)
+  state.http2.goaway_sent = true
+  event.finish(state)
+end
+
+-- Run the servlet of a stream whose request has arrived.
+local function start(state, id, stream)
+  local session = state.http2
+  local conn = session.conn
+  session.receiving[id] = nil
+  local servlet_state = setmetatable({
+    request = stream.request,
+    clientfd_read = ch2.body_file(table.concat(stream.body)),
+    clientfd_write = conn:stream_file(id),
+    client_address = state.client_address,
+    listen_address = state.listen_address,
+    tls = state.tls,
+    -- The connection and the id of the stream. See write_headers().
+    h2 = {conn = conn, id = id},
+    response_headers_written = false,
+    response_headers = {},
+  }, getmetatable(state))
+  local ok, errmsg = pcall(session.run, servlet_state)
+  if ok and servlet_state.deferred then
+    session.deferred[id] = servlet_state
+    local timeout = servlet_state.deferred_timeout or config.cfg.deferred_timeout
+    event.park(servlet_state, timeout)
+    return
+  end
+  if ok then
+    ok, errmsg = pcall(servlet_state.end_response, servlet_state)
+  end
+  if not ok then
+    print(errmsg)
+    -- The client must not take a partial response for a whole one.
+    conn:rst_stream(id, INTERNAL_ERROR)
+  end
+  servlet_state.clientfd_read:close()
+  servlet_state.clientfd_write:close()
+end
+
+-- Handle a whole header block: the request of a new stream or the trailers of a body.
+local function headers(state, id, flags, block)
+  local session = state.http2
+  local conn = session.conn
+  -- Decode even the blocks of ignored streams to keep the HPACK tables in step.
+  local fields = conn:decode(block)
+  if not fields then
+    return connection_error(state, COMPRESSION_ERROR)
+  end
+  if id <= session.last_id then
+    -- Trailers are dropped. Frames of a stream that was reset are ignored.
+    local stream = session.receiving[id]
+    if stream and has(flags, END_STREAM) then
+      start(state, id, stream)
+    end
+    return
+  end
+  if id % 2 == 0 then
+    return connection_error(state, PROTOCOL_ERROR)
+  end
+  session.last_id = id
+  if open_streams(session) >= MAX_STREAMS then
+    conn:rst_stream(id, REFUSED_STREAM)
+    return
+  end
+  local request = make_request(fields)
+  if not request then
+    conn:rst_stream(id, PROTOCOL_ERROR)
+    return
+  end
+  local stream = {request = request, body = {}, size = 0}
+  if has(flags, END_STREAM) then
+    start(state, id, stream)
+    return
+  end
+  session.receiving[id] = stream
+  if request.headers["expect"] == "100-continue" then
+    conn:send_headers(id, conn:encode{":status", "100"}, false)
+  end
+end
+
+local function handle_frame(state, kind, flags, id, payload, length)
+  local session = state.http2
+  local conn = session.conn
+  local block = session.block
+  if block and kind ~= CONTINUATION then
+    return connection_error(state, PROTOCOL_ERROR)
+  end
+  if kind == HEADERS then
+    if id == 0 then
+      return connection_error(state, PROTOCOL_ERROR)
+    end
+    if has(flags, END_HEADERS) then
+      headers(state, id, flags, payload)
+    else
+      session.block = {id = id, flags = flags, size = #payload, payload}
+    end
+  elseif kind == CONTINUATION then
+    if not block or block.id ~= id then
+      return connection_error(state, PROTOCOL_ERROR)
+    end
+    table.insert(block, payload)
+    block.size = block.size + #payload
+    if block.size > MAX_HEADER_BLOCK then
+      return connection_error(state, ENHANCE_YOUR_CALM)
+    end
+    if has(flags, END_HEADERS) then
+      session.block = nil
+      headers(state, id, block.flags, table.concat(block))
+    end
+  elseif kind == DATA then
+    local stream = session.receiving[id]
+    if not stream then
+      if id == 0 or id > session.last_id then
+        return connection_error(state, PROTOCOL_ERROR)
+      end
+      -- The stream was reset or its request already ended.
+      return
+    end
+    stream.size = stream.size + #payload
+    if stream.size > MAX_BODY then
+      session.receiving[id] = nil
+      conn:send_headers(id, conn:encode{":status", "413", "content-length", "0"}, true)
+      conn:rst_stream(id, NO_ERROR)
+      return
+    end
+    table.insert(stream.body, payload)
+    if has(flags, END_STREAM) then
+      start(state, id, stream)
+    else
+      conn:window_update(id, length)
+    end
+  elseif kind == RST_STREAM then
+    session.receiving[id] = nil
+    local stream = session.deferred[id]
+    if stream then
+      session.deferred[id] = nil
+      stream:finish()
+    end
+  elseif kind == GOAWAY then
+    -- The client opens no more streams. Close once the open ones are done.
+    session.goaway_received = true
+  elseif kind == PUSH_PROMISE then
+    return connection_error(state, PROTOCOL_ERROR)
+  end
+end
+
+--[[
+Handle the frames the client has sent, then read more until nothing is left. A servlet
+that waits for its flow control window reads frames too, so what was read during a frame
+is handled before the connection goes back to the event loop.
+--]]
+local function receive(state)
+  local session = state.http2
+  local conn = session.conn
+  while true do
+    while true do
+      local kind, flags, id, payload, length = conn:frame()
+      if kind == nil then
+        break
+      elseif kind == false then
+        return connection_error(state, flags)
+      end
+      session.active = cutil.now()
+      handle_frame(state, kind, flags, id, payload, length)
+      if state.finished then
+        return
+      end
+    end
+    local count = conn:fill()
+    if not count then
+      -- The client closed the connection.
+      return event.finish(state)
+    elseif count == 0 then
+      break
+    end
+  end
+  if session.goaway_received and open_streams(session) == 0 then
+    return event.finish(state)
+  end
+  conn:flush()
+  event.watch(state, session.fd, function(self)
+    local ok, errmsg = pcall(receive, self)
+    if not ok then
+      print(errmsg)
+      connection_error(self, INTERNAL_ERROR)
+    end
+  end)
+end
+
+-- Close the connection once it has had no open streams for http2_idle_timeout.
+local function idle_timer(state, milliseconds)
+  event.timer(state, milliseconds, function(self)
+    local timeout = config.cfg.http2_idle_timeout * 1000
+    local idle = cutil.now() - self.http2.active
+    if open_streams(self.http2) > 0 then
+      idle_timer(self, timeout)
+    elseif idle >= timeout then
+      event.finish(self)
+    else
+      idle_timer(self, timeout - idle)
+    end
+  end)
+end
+
+--[[
+Take over a connection whose preface was read by handle_request(). run(state) runs the
+servlet of a stream. Return the state of the connection, which is deferred until the
+client or the idle timeout closes it.
+--]]
+function h2.serve(state, run)
+  -- The stream of a TLS connection in user space has no descriptor.
+  local fd = state.tls and state.tls.fd or stdio.fileno(state.clientfd_read)
+  local conn = ch2.connection(state.clientfd_read, state.clientfd_write, fd)
+  state.http2 = {
+    conn = conn,
+    fd = fd,
+    run = run,
+    -- Streams whose request is still arriving, by id.
+    receiving = {},
+    -- Streams whose servlet deferred the response, by id.
+    deferred = {},
+    -- The highest stream id the client has used.
+    last_id = 0,
+    -- When the client last sent a frame.
+    active = cutil.now(),
+  }
+  state.end_response = close
+  state:defer()
+  state.deferred_timeout = 0
+  conn:preface()
+  if config.cfg.http2_idle_timeout > 0 then
+    idle_timer(state, config.cfg.http2_idle_timeout * 1000)
+  end
+  -- The client may have sent its first frames with the preface.
+  receive(state)
+  return state
+end
+
+-- Tests below this line:
+------------------------------------------------------------------------------------------
+
+if os.getenv("TEST") == "1" then
+  local function hex(s)
+    return (s:gsub("%x%x", function(byte) return string.char(tonumber(byte, 16)) end))
+  end
+
+  -- The requests of RFC 7541 Appendix C.4, which share a dynamic table.
+  do
+    local conn = ch2.connection(io.tmpfile(), io.tmpfile())
+    local fields = conn:decode(hex("828684418cf1e3c2e5f23a6ba0ab90f4ff"))
+    assert(table.concat(fields, " ") == ":method GET :scheme http :path / :authority "
+      .. "www.example.com")
+    fields = conn:decode(hex("828684be5886a8eb10649cbf"))
+    assert(fields[8] == "www.example.com" and fields[10] == "no-cache")
+    fields = conn:decode(hex("828785bf408825a849e95ba97d7f8925a849e95bb8e8b4bf"))
+    assert(table.concat(fields, " ") == ":method GET :scheme https :path /index.html "
+      .. ":authority www.example.com custom-key custom-value")
+    -- An index past the dynamic table and a truncated string.
+    assert(conn:decode(hex("ff00")) == nil)
+    assert(conn:decode(hex("408825a849")) == nil)
+    conn:close()
+  end
+
+  -- The encoder of one end and the decoder of the other stay in step.
+  do
+    local server = ch2.connection(io.tmpfile(), io.tmpfile())
+    local client = ch2.connection(io.tmpfile(), io.tmpfile())
+    local fields = {":status", "200", "content-type", "text/css",
+      "content-length", "1234", "x-binary", "\0\255\r\n"}
+    local block = server:encode(fields)
+    assert(table.concat(client:decode(block), "|") == table.concat(fields, "|"))
+    local again = server:encode(fields)
+    assert(#again < #block)
+    assert(table.concat(client:decode(again), "|") == table.concat(fields, "|"))
+    server:close()
+    client:close()
+  end
+
+  -- Frames written by one connection read back by another.
+  do
+    local file = io.tmpfile()
+    local writer = ch2.connection(io.tmpfile(), file)
+    writer:send_headers(1, writer:encode{":method", "GET", ":path", "/a?b=c"}, true)
+    writer:window_update(1, 10)
+    writer:rst_stream(1, 8)
+    writer:flush()
+    file:seek("set")
+    local reader = ch2.connection(file, io.tmpfile(), stdio.fileno(file))
+    assert(reader:fill() > 0)
+    local kind, flags, id, payload = reader:frame()
+    assert(kind == HEADERS and flags == END_STREAM + END_HEADERS and id == 1)
+    local request = make_request(reader:decode(payload))
+    assert(request.method == "GET" and request.uri_path == "/a")
+    assert(request.query.b == "c")
+    -- The WINDOW_UPDATE is handled by the connection.
+    kind, flags, id, payload = reader:frame()
+    assert(kind == RST_STREAM and id == 1 and payload == "\0\0\0\8")
+    assert(reader:frame() == nil)
+    writer:close()
+    reader:close()
+  end
+
+  -- Each value of a list is a field of its own.
+  do
+    local file = io.tmpfile()
+    local writer = ch2.connection(io.tmpfile(), file)
+    local state = {
+      h2 = {conn = writer, id = 1},
+      response_headers = {
+        ["set-cookie"] = {name = "Set-Cookie", value = {"a=1", "b=2"}},
+        ["content-length"] = {name = "Content-Length", value = 0},
+      },
+      get_method = function() return "GET" end,
+    }
+    h2.write_headers(state)
+    assert(state.response_body == "none")
+    writer:flush()
+    file:seek("set")
+    local reader = ch2.connection(file, io.tmpfile(), stdio.fileno(file))
+    assert(reader:fill() > 0)
+    local kind, flags, id, payload = reader:frame()
+    assert(kind == HEADERS and flags == END_STREAM + END_HEADERS and id == 1)
+    local cookies = {}
+    local fields = reader:decode(payload)
+    for i = 1, #fields, 2 do
+      if fields[i] == "set-cookie" then
+        cookies[#cookies + 1] = fields[i + 1]
+      end
+    end
+    assert(table.concat(cookies, " ") == "a=1 b=2")
+    writer:close()
+    reader:close()
+  end
+
+  -- A WINDOW_UPDATE that overflows the window of a stream resets only that stream.
+  do
+    local file = io.tmpfile()
+    local writer = ch2.connection(io.tmpfile(), file)
+    writer:send_headers(1, writer:encode{":method", "POST", ":path", "/"}, false)
+    writer:window_update(1, 0x7fffffff)
+    writer:flush()
+    file:seek("set")
+    local out = io.tmpfile()
+    local reader = ch2.connection(file, out, stdio.fileno(file))
+    assert(reader:fill() > 0)
+    assert(reader:frame() == HEADERS)
+    local kind, flags, id, payload = reader:frame()
+    assert(kind == RST_STREAM and id == 1 and payload == "\0\0\0\3")
+    reader:flush()
+    out:seek("set")
+    assert(out:read("*a") == "\0\0\4\3\0\0\0\0\1\0\0\0\3")
+    writer:close()
+    reader:close()
+  end
+
+  do
+    local file = ch2.body_file("body")
+    assert(file:read("*a") == "body")
+    file:close()
+    file = ch2.body_file("")
+    assert(file:read("*a") == "")
+    file:close()
+  end
+
+  print("h2.lua test complete")
+end
+
+return h2
@@ -98,8 +98,14 @@ local function errnum_to_status(errnum)
   return nil, http.reason_phrase[status], status
 end
 
+-- The first bytes a client sends on an HTTP/2 connection. See h2.lua.
+http.h2_preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
+
 --[[
 Read the status line and headers from an HTTP request. The body is left unread.
+
+The HTTP/2 connection preface reads like a request line with the method PRI. It is 
+returned as such a request, without headers, for the caller to switch protocols.
 --]]
 function http.read_and_parse_request(file)
   local request_line, errmsg, errnum = util.fgets(4096, file)
@@ -110,6 +116,12 @@ function http.read_and_parse_request(file)
       return errnum_to_status(errnum)
     end
   end
+  if request_line == "PRI * HTTP/2.0\r\n" then
+    if file:read(#http.h2_preface - #request_line) ~= "\r\nSM\r\n\r\n" then
+      return nil, "Bad Request", 400
+    end
+    return {method = "PRI", version = "HTTP/2.0", uri = "*", headers = {}, query = {}}
+  end
   local method, uri, version = http.parse_request_line(request_line)
   if not (method and uri and version) then
     return nil, "Bad Request", 400
@@ -145,6 +157,7 @@ function http.read_and_parse_request(file)
   end
   local request = {
     method = method,
+    version = version,
     uri = uri,
     uri_path = uri_path,
     headers = headers,
@@ -154,15 +167,34 @@ function http.read_and_parse_request(file)
 end
 
 function http.write_status_line(file, status)
-  local status_line 
-    = ("HTTP/1.1 %u %s\r\n"):format(status, http.reason_phrase[status] or "")
-  assert(file:write(status_line))
+  assert(file:write(http.status_line(status)))
 end
 
-function http.write_headers(file, headers)
+--[[
+Return the header lines of a header table as one string. A header value may be an array of
+values to write the header once for each value. This is needed for headers like Set-Cookie
+that cannot be combined into one line.
+--]]
+function http.header_lines(headers)
+  local lines, n = {}, 0
   for _, pair in pairs(headers) do
-    assert(file:write(pair.name, ": ", pair.value, "\r\n"))
+    if type(pair.value) == "table" then
+      for _, value in ipairs(pair.value) do
+        lines[n + 1], lines[n + 2], lines[n + 3], lines[n + 4]
+          = pair.name, ": ", value, "\r\n"
+        n = n + 4
+      end
+    else
+      lines[n + 1], lines[n + 2], lines[n + 3], lines[n + 4]
+        = pair.name, ": ", pair.value, "\r\n"
+      n = n + 4
+    end
   end
+  return table.concat(lines, "", 1, n)
+end
+
+function http.write_headers(file, headers)
+  assert(file:write(http.header_lines(headers)))
 end
 
 function http.write_chunk(file, chunk)
@@ -237,6 +269,31 @@ http.reason_phrase = {
   [511] = "Network Authentication Required",
 }
 
+--[[
+Status lines are formatted once for every known status code rather than per response.
+--]]
+local status_lines = {}
+for status, phrase in pairs(http.reason_phrase) do
+  status_lines[status] = ("HTTP/1.1 %u %s\r\n"):format(status, phrase)
+end
+
+function http.status_line(status)
+  return status_lines[status] or ("HTTP/1.1 %u \r\n"):format(status)
+end
+
+--[[
+The value of the Date header, which only changes once per second. os.date() is called when
+the second changes rather than for every response.
+--]]
+local date_time, date_value
+function http.date()
+  local now = os.time()
+  if now ~= date_time then
+    date_time, date_value = now, os.date("!%a, %d %b %Y %H:%M:%S GMT", now)
+  end
+  return date_value
+end
+
 -- Tests below this line:
 ------------------------------------------------------------------------------------------
 
@@ -378,6 +435,11 @@ if os.getenv("TEST") == "1" then
     assert(pr == nil)
     assert(errstr == nil)
     assert(errnum == nil)
+    
+    pr = request{"PRI * HTTP/2.0", "", "SM", "", ""}
+    assert(pr.method == "PRI" and pr.version == "HTTP/2.0")
+    pr, errstr, errnum = request{"PRI * HTTP/2.0", "", "", ""}
+    assert(pr == nil and errnum == 400)
   end
   
   do
@@ -423,6 +485,17 @@ if os.getenv("TEST") == "1" then
     file:close()
   end
   
+  do
+    assert(http.status_line(404) == "HTTP/1.1 404 Not Found\r\n")
+    assert(http.status_line(599) == "HTTP/1.1 599 \r\n")
+    local date = http.date()
+    assert(date:match("^%a%a%a, %d%d %a%a%a %d%d%d%d %d%d:%d%d:%d%d GMT$"))
+    local lines = http.header_lines({
+      ["set-cookie"] = {name = "Set-Cookie", value = {"a=1", "b=2"}},
+    })
+    assert(lines == "Set-Cookie: a=1\r\nSet-Cookie: b=2\r\n")
+  end
+  
   do
     assert(http.reason_phrase[200] == "OK")
     assert(http.reason_phrase[404] == "Not Found")
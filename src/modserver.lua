@@ -2,6 +2,10 @@
 
 local api = require("api.lua.modserver")
 local config = require("config")
+local ctls = require("ctls")
+local cutil = require("cutil")
+local event = require("event")
+local h2 = require("h2")
 local http = require("http")
 local util = require("util")
 --[[
@@ -12,9 +16,7 @@ local errno = require("posix.errno")
 local signal = require("posix.signal")
 local socket = require("posix.sys.socket")
 local stat = require("posix.sys.stat")
-local stdio = require("posix.stdio")
 local poll = require("posix.poll")
-local time = require("posix.time")
 local unistd = require("posix.unistd")
 local wait = require("posix.sys.wait")
 
@@ -47,20 +49,67 @@ function main.parent_loop()
     end
   end)
   
+  -- Reload the server gracefully when SIGHUP is received.
+  local reload_requested = false
+  signal.signal(signal.SIGHUP, function()
+    reload_requested = true
+  end)
+  
   -- The parent and children communicate over a pipe.
   local read_pipe, write_pipe = assert(unistd.pipe())
   util.set_close_on_exec(read_pipe)
   util.set_close_on_exec(write_pipe)
   
+  --[[
+  Children watch the read end of the lifeline pipe. Only the parent holds the write end, 
+  so it is closed when the parent re-executes itself on a reload. The children see the 
+  hangup, finish their current request, and exit.
+  --]]
+  local lifeline_read, lifeline_write = assert(unistd.pipe())
+  util.set_close_on_exec(lifeline_read)
+  util.set_close_on_exec(lifeline_write)
+  
   local poll_fds = {
     [read_pipe] = {events = {IN = true}},
   }
   util.set_nonblocking(read_pipe)
+  
+  local watcher
+  local poll_timeout = config.cfg.poll_timeout
+  if config.cfg.reload then
+    watcher = main.servlet_watcher()
+    if watcher.fd then
+      poll_fds[watcher.fd] = {events = {IN = true}}
+    else
+      -- Check for modified servlets more often when polling with stat().
+      poll_timeout = 100
+    end
+  end
 
   -- Keep track of forked child processes by their pid.
   local children = {}
   local num_children = 0
   local num_children_ready = 0
+  
+  local function fork_child(exit_on_timeout)
+    local childpid, errstr, errmsg = unistd.fork()
+    if childpid then
+      if childpid == 0 then
+        -- a new child process
+        unistd.close(read_pipe)
+        unistd.close(lifeline_write)
+        main.child_loop(write_pipe, lifeline_read, config.listenfds, exit_on_timeout)
+        error("returned from child_loop()")
+      elseif childpid > 0 then
+        -- the same parent process
+        children[childpid] = {state = "f", exit_on_timeout = exit_on_timeout}
+        num_children = num_children + 1
+      end
+    else
+      print(errstr, errmsg)
+    end
+  end
+  
   while true do
     --[[
     The parent process forks a child process when there are no ready child processes. A 
@@ -68,30 +117,16 @@ function main.parent_loop()
     --]]
     assert(num_children_ready >= 0, "negative num_children_ready")
     if num_children_ready == 0 then
-      local childpid, errstr, errmsg = unistd.fork()
-      if childpid then
-        if childpid == 0 then
-          -- a new child process
-          unistd.close(read_pipe)
-          main.child_loop(write_pipe, config.listenfds, num_children > 0)
-          error("returned from child_loop()")
-        elseif childpid > 0 then
-          -- the same parent process
-          children[childpid] = {state = "f"}
-          num_children = num_children + 1
-        end
-      else
-        print(errstr, errmsg)
-      end
+      fork_child(num_children > 0)
     end
     
     --[[
     Wait for messages from children until the poll timeout is reached.
     --]]
-    local ret = poll.poll(poll_fds, config.cfg.poll_timeout)
+    local ret = poll.poll(poll_fds, poll_timeout)
     if ret and ret > 0 then
       for fd in pairs(poll_fds) do
-        if poll_fds[fd].revents.IN then
+        if fd == read_pipe and poll_fds[fd].revents.IN then
           repeat
             -- The parent waits on one pipe for messages from many children.
             local data, errmsg, errnum = unistd.read(read_pipe, 21 * 128)
@@ -100,7 +135,7 @@ function main.parent_loop()
               -- [20 byte padded string pid][1 byte command]
               -- 00000000000000018838+
               -- The message is always 21 bytes in size.
-              for strpid, cmd in data:gmatch("(%d+)([-+])") do
+              for strpid, cmd in data:gmatch("(%d+)([-+x])") do
                 local numpid = tonumber(strpid)
                 local child = children[numpid]
                 if child then
@@ -109,6 +144,13 @@ function main.parent_loop()
                   elseif cmd == "-" then
                     assert(child.state == "+")
                     num_children_ready = num_children_ready - 1
+                  elseif cmd == "x" then
+                    --[[
+                    The child is busy and exits once its connection is closed. Replace 
+                    it now rather than after it exits so capacity never dips.
+                    --]]
+                    assert(child.state == "-")
+                    fork_child(child.exit_on_timeout)
                   else
                     print(data)
                     error("bad cmd")
@@ -122,65 +164,219 @@ function main.parent_loop()
       end
     end
     
+    -- The children encrypt new session tickets with the new key right away.
+    for _, tls_context in pairs(config.tls_contexts) do
+      local rotated, errmsg = tls_context:rotate_ticket_keys()
+      if not rotated and errmsg then
+        print(errmsg)
+      end
+    end
+    
     --[[
     Wait for state changes in the child processes, if any. Report the pid of any crashes.
     --]]
     repeat
       local pid, status, code = wait.wait(-1, wait.WNOHANG)
       if pid and pid ~= 0 then
+        --[[
+        Children forked before a reload are still children of this process but are not 
+        tracked. They are draining and only need to be reaped.
+        --]]
         local child = children[pid]
-        if child and child.state == "+" then
-          num_children_ready = num_children_ready - 1
+        if child then
+          if child.state == "+" then
+            num_children_ready = num_children_ready - 1
+          end
+          children[pid] = nil
+          num_children = num_children - 1
+          assert(num_children >= 0, "negative num_children")
         end
-        children[pid] = nil
-        num_children = num_children - 1
-        assert(num_children >= 0, "negative num_children")
         if code ~= 0 then
           print(pid, status, code)
         end
       end
     until not pid or pid == 0 or pid == -1
     
-    if config.cfg.reload then
+    if watcher then
       --[[
-      Check the file modification time of each servlet to see if a reload is necessary.
+      Load each modified servlet again in this process so new children fork with the new 
+      copy. Existing children load it again between requests when they see its 
+      generation change. The server only restarts when a module cannot load the same 
+      servlet twice.
       --]]
-      for path, servlet in pairs(config.servlets) do 
-        local stat_tbl = stat.stat(servlet.path)
-        if stat_tbl and servlet.file_modified_time < stat_tbl.st_mtime then
-          print("reload")
-          for strpid, _ in pairs(children) do
-            signal.kill(tonumber(strpid), signal.SIGKILL)
-          end
-          while (wait.wait()) do
-            -- Wait for children to exit.
-          end
-          --[[
-          FIXME: find a better way to accomplish this 
-          Sleep before restarting to avoid opening the servlet while it is still being
-          written to disk.
-          --]]
-          time.nanosleep({tv_sec = 0, tv_nsec = 100000000})
-          --[[
-          Example arguments for the call below:
-          unistd.execp("./modserver", {[0] = "./modserver", [1] = "config.conf"})
-          --]]
-          unistd.execp(arg[0], {[0] = arg[0], [1] = arg[1]})
+      for path in pairs(main.modified_servlets(watcher)) do
+        print("reload", path)
+        if not config.reload_servlet(path) then
+          reload_requested = true
         end
       end
     end
+    
+    if reload_requested then
+      reload_requested = false
+      main.reload()
+    end
+  end
+end
+
+--[[
+Watch the servlet files for modifications. inotify is used when available so the parent 
+sleeps until a servlet is written. Otherwise every servlet is checked with stat() each 
+time around the parent loop.
+--]]
+function main.servlet_watcher()
+  local watcher = {dirs = {}}
+  if cutil.inotify_init then
+    watcher.fd = cutil.inotify_init()
+  end
+  if watcher.fd then
+    local wds = {}
+    for path in pairs(config.servlets) do
+      local dir, name = path:match("^(.*)/([^/]+)$")
+      if not dir then
+        dir, name = ".", path
+      end
+      if not wds[dir] then
+        wds[dir] = cutil.inotify_add_watch(watcher.fd, dir)
+        if wds[dir] then
+          watcher.dirs[wds[dir]] = {}
+        end
+      end
+      if wds[dir] then
+        watcher.dirs[wds[dir]][name] = path
+      end
+    end
+  end
+  return watcher
+end
+
+--[[
+Return a set of the paths of servlets modified since the last call.
+--]]
+function main.modified_servlets(watcher)
+  local modified = {}
+  if watcher.fd then
+    for _, event in ipairs(cutil.inotify_read(watcher.fd)) do
+      local names = watcher.dirs[event.wd]
+      local path = names and names[event.name]
+      if path then
+        modified[path] = true
+      end
+    end
+  else
+    for path, servlet in pairs(config.servlets) do 
+      local stat_tbl = stat.stat(path)
+      if stat_tbl and servlet.file_modified_time < stat_tbl.st_mtime then
+        --[[
+        Wait until the file looks the same on two checks in a row to avoid loading a 
+        servlet that is still being written to disk.
+        --]]
+        if servlet.pending_mtime == stat_tbl.st_mtime 
+          and servlet.pending_size == stat_tbl.st_size then
+          modified[path] = true
+        end
+        servlet.pending_mtime = stat_tbl.st_mtime
+        servlet.pending_size = stat_tbl.st_size
+      end
+    end
+  end
+  return modified
+end
+
+--[[
+Replace the server with a fresh copy of itself without dropping any connections. The 
+listening sockets stay open across the exec so new connections wait in the backlog 
+instead of being refused. Existing children keep serving their current request and exit 
+when they see the lifeline pipe close.
+--]]
+function main.reload()
+  print("reload")
+  config.export_listenfds()
+  --[[
+  Example arguments for the call below:
+  unistd.execp("./modserver", {[0] = "./modserver", [1] = "config.conf"})
+  --]]
+  local _, errmsg = unistd.execp(arg[0], {[0] = arg[0], [1] = arg[1]})
+  -- execp() only returns on failure. Keep running the current configuration.
+  print("reload failed:", errmsg)
+  config.unexport_listenfds()
+end
+
+--[[
+Return the read and write streams of an accepted connection and, for a listening socket 
+with the tls option, the description of the TLS session. Return nil after closing the 
+connection if the TLS handshake failed.
+--]]
+function main.open_connection(listenfd, clientfd)
+  -- Programs started by servlets, such as CGI scripts, must not hold the connection open.
+  util.set_close_on_exec(clientfd)
+  local tls_context = config.tls_contexts[listenfd]
+  if tls_context then
+    local read_file, write_file, tls = ctls.accept(tls_context, clientfd)
+    if not read_file then
+      unistd.close(clientfd)
+    end
+    return read_file, write_file, tls
+  end
+  local read_file = assert(util.fdopen(clientfd, "r"))
+  local clientfd2 = assert(unistd.dup(clientfd))
+  util.set_close_on_exec(clientfd2)
+  local write_file = assert(util.fdopen(clientfd2, "w"))
+  return read_file, write_file
+end
+
+--[[
+Choose the servlet for the request of state and run it.
+--]]
+function main.run_servlet(state)
+  local servlet = config.routes[state.request.uri_path]
+  if servlet then
+    --[[
+    8.2.3 Use of the 100 (Continue) Status
+    https://tools.ietf.org/html/rfc2616#section-8.2.3
+    HTTP/2 streams have their body read before the servlet runs. See h2.lua.
+    --]]
+    if state.request.headers["expect"] == "100-continue" and not state.h2 then
+      assert(state.clientfd_write:write("HTTP/1.1 100 Continue\r\n\r\n"))
+      -- flush() because the user expects prompt notification of the status.
+      assert(state.clientfd_write:flush())
+    end
+    if not servlet.initialized then
+      if servlet.init then
+        servlet.init(state)
+        -- Override languages that set their own signal handlers.
+        util.set_default_signal_handlers()
+      end
+      servlet.initialized = true
+    end
+    -- Call the servlet to handle the request.
+    servlet.run(state)
+  else
+    -- No servlet can handle the request.
+    state:set_status(404)
+    state:rwrite("404 Not Found")
   end
 end
 
 --[[
 Read the request, choose the servlet to handle the request, run the servlet, and close 
-the connection.
+the connection. Return the servlet state if the servlet deferred the request, in which 
+case the connection stays open until the servlet finishes it.
 --]]
-function main.handle_request(read_file, write_file)
+function main.handle_request(read_file, write_file, client_address, listen_address, tls)
   local state = {
     request = {method = "", headers = {}, query = {}},
     clientfd_read = read_file,
     clientfd_write = write_file,
+    -- The {family, addr, port} table returned by accept().
+    client_address = client_address,
+    -- The address string passed to listen() for the socket that accepted the connection.
+    listen_address = listen_address,
+    --[[
+    For a TLS connection, {version, cipher, resumed, ktls_send, ktls_recv, fd, alpn} as 
+    returned by ctls.accept(). Nil for plain HTTP.
+    --]]
+    tls = tls,
     response_headers_written = false,
     response_headers = {},
   }
@@ -188,32 +384,11 @@ function main.handle_request(read_file, write_file)
   local request, errmsg, errnum = http.read_and_parse_request(state.clientfd_read)
   if request then
     state.request = request
-    local servlet = config.routes[request.uri_path]
-    if servlet then
-      --[[
-      8.2.3 Use of the 100 (Continue) Status
-      https://tools.ietf.org/html/rfc2616#section-8.2.3
-      --]]
-      if state.request.headers["expect"] == "100-continue" then
-        assert(state.clientfd_write:write("HTTP/1.1 100 Continue\r\n\r\n"))
-        -- flush() because the user expects prompt notification of the status.
-        assert(state.clientfd_write:flush())
-      end
-      if not servlet.initialized then
-        if servlet.init then
-          servlet.init(state)
-          -- Override languages that set their own signal handlers.
-          util.set_default_signal_handlers()
-          servlet.initialized = true
-        end
-      end
-      -- Call the servlet to handle the request.
-      servlet.run(state)
-    else
-      -- No servlet can handle the request.
-      state:set_status(404)
-      state:rwrite("404 Not Found")
+    if request.method == "PRI" then
+      -- The client speaks HTTP/2. Each stream of the connection runs a servlet.
+      return h2.serve(state, main.run_servlet)
     end
+    main.run_servlet(state)
   else
     if errnum then
       state:set_status(errnum)
@@ -226,18 +401,10 @@ function main.handle_request(read_file, write_file)
       return
     end
   end
-  if not state.response_headers_written then
-    --[[
-    The servlet did not write any data.
-    --]]
-    state:set_status(204)
-    state:set_header("Content-Length", "0")
-    state:write_status_line_and_headers()
-  end
-  if not state.response_headers["content-length"] then
-    -- Send the last chunk of the chunked response.
-    assert(state.clientfd_write:write("0\r\n\r\n"))
+  if state.deferred then
+    return state
   end
+  state:end_response()
   --[[
   flush() does not need to be called because the stream is automatically flushed when the 
   connection is closed. However, keep this reminder here because flush() must be used if 
@@ -260,6 +427,43 @@ function main.child_is_busy(write_pipe, padded_pid)
   unistd.write(write_pipe, padded_pid .. "-")
 end
 
+--[[
+A busy child may also tell the parent it is about to exit:
+  (x) Retiring after the current connection. The parent forks a replacement.
+--]]
+function main.child_is_retiring(write_pipe, padded_pid)
+  unistd.write(write_pipe, padded_pid .. "x")
+end
+
+--[[
+Give each servlet used by this child a chance to clean up, then exit.
+--]]
+function main.child_exit()
+  for _, servlet in pairs(config.servlets) do
+    config.cleanup_servlet(servlet)
+  end
+  unistd._exit(0)
+end
+
+--[[
+Decide whether a child should be replaced after handling a request. Leaky servlets 
+otherwise grow without bound because a busy child never reaches the idle timeout.
+--]]
+function main.child_should_retire(num_requests)
+  local max_requests = config.cfg.max_requests_per_worker
+  if max_requests > 0 and num_requests >= max_requests then
+    return true
+  end
+  local max_rss = config.cfg.max_worker_rss
+  if max_rss > 0 then
+    local rss = cutil.maxrss()
+    if rss and rss >= max_rss then
+      return true
+    end
+  end
+  return false
+end
+
 --[[
 Each child process waits to accept one connection on the same server socket. The kernel 
 load balances the connections across all child processes. The child tells the parent of 
@@ -267,57 +471,107 @@ two events: before the child waits on accept and after the child accepts a conne
 The parent uses these events to keep track of how many child are ready to handle new 
 connections.
 --]]
-function main.child_loop(write_pipe, listenfds, exit_on_timeout)
+function main.child_loop(write_pipe, lifeline_read, listenfds, exit_on_timeout)
+  -- The parent handles SIGHUP. Children learn about a reload from the lifeline pipe.
+  signal.signal(signal.SIGHUP, signal.SIG_IGN)
   local mypid = unistd.getpid()
   local padded_pid = ("%020u"):format(mypid)
+  local num_requests = 0
   main.child_is_ready(write_pipe, padded_pid)
   local poll_fds = {}
   for i, fd in ipairs(listenfds) do
     poll_fds[fd] = {events = {IN = true}}
   end
+  poll_fds[lifeline_read] = {events = {IN = true}}
+  --[[
+  A draining child accepts no more connections and exits once its deferred requests are 
+  finished.
+  --]]
+  local draining = false
+  local function drain()
+    if event.count() == 0 then
+      main.child_exit()
+    end
+    draining = true
+    for fd in pairs(poll_fds) do
+      if not event.is_watched(fd) then
+        poll_fds[fd] = nil
+      end
+    end
+  end
   while true do
-    local ret, errmsg, errnum = poll.poll(poll_fds, 5000)
+    event.update_poll_fds(poll_fds)
+    local ret, errmsg, errnum = poll.poll(poll_fds, event.timeout(draining and -1 or 5000))
     if ret then
-      if ret > 0 then
+      if ret > 0 and not draining then
+        local lifeline = poll_fds[lifeline_read].revents
+        if lifeline.IN or lifeline.HUP then
+          -- The parent is gone or reloading. Stop accepting connections and exit.
+          drain()
+        end
+      end
+      if ret > 0 and not draining then
         for fd in pairs(poll_fds) do
-          if poll_fds[fd].revents.IN then
-            local clientfd, _, _ = socket.accept(fd)
+          -- drain() clears the listening sockets from poll_fds during the loop.
+          if not draining and fd ~= lifeline_read and not event.is_watched(fd) 
+            and poll_fds[fd].revents.IN then
+            local clientfd, client_address = socket.accept(fd)
             if clientfd then
               main.child_is_busy(write_pipe, padded_pid)
+              config.reload_modified_servlets()
               --[[
               A read from the socket returns with an error after five seconds of 
               inactivity rather than blocking forever.
               --]]
               socket.setsockopt(clientfd, socket.SOL_SOCKET, socket.SO_RCVTIMEO, 5, 0)
-              local read_file  = assert(stdio.fdopen(clientfd, "r"))
-              local clientfd2 = assert(unistd.dup(clientfd))
-              local write_file = assert(stdio.fdopen(clientfd2, "w"))
-              -- Use pcall() to catch any errors. The connection is closed regardless.
-              local ok, errstr, errnum = pcall(main.handle_request, read_file, write_file)
+              local read_file, write_file, tls = main.open_connection(fd, clientfd)
+              --[[
+              Use pcall() to catch any errors. The connection is closed regardless unless 
+              the servlet deferred the request.
+              --]]
+              local ok, deferred = true, nil
+              if read_file then
+                ok, deferred = pcall(main.handle_request, read_file, write_file, 
+                  client_address, config.listen_addresses[fd], tls)
+              end
               if not ok then
-                print(errstr, errnum)
+                print(deferred)
+              end
+              if ok and deferred then
+                -- A servlet may lift the limit for a long-lived request such as an event stream.
+                event.park(deferred, deferred.deferred_timeout or config.cfg.deferred_timeout)
+              elseif read_file then
+                read_file:close()
+                write_file:close()
+              end
+              num_requests = num_requests + 1
+              if main.child_should_retire(num_requests) then
+                main.child_is_retiring(write_pipe, padded_pid)
+                drain()
+              else
+                main.child_is_ready(write_pipe, padded_pid)
               end
-              read_file:close()
-              write_file:close()
-              main.child_is_ready(write_pipe, padded_pid)
             else
               if errnum == errno.EAGAIN or errnum == errno.EWOULDBLOCK then
                 -- accept() timed out due to SO_RCVTIMEO.
                 -- TODO: also take a timestamp before accept to tell the difference 
                 -- between SO_RCVTIMEO and accept returning EAGAIN due to thundering 
                 -- herd.
-                if exit_on_timeout then
-                  unistd._exit(0)
+                if exit_on_timeout and event.count() == 0 then
+                  main.child_exit()
                 end
               end
             end
           end
         end
-      elseif ret == 0 then
+      end
+      event.dispatch(poll_fds)
+      if draining and event.count() == 0 then
+        main.child_exit()
+      end
+      if ret == 0 and exit_on_timeout and event.count() == 0 then
         -- poll() timeout.
-        if exit_on_timeout then
-          unistd._exit(0)
-        end
+        main.child_exit()
       end
     end
   end
@@ -344,8 +598,8 @@ if os.getenv("TEST") == "1" then
         family = socket.AF_INET, socktype = socket.SOCK_STREAM 
       })
       assert(socket.connect(fd, addr[1]))
-      local readf = assert(stdio.fdopen(fd, "r"))
-      local writef = assert(stdio.fdopen(fd, "w"))
+      local readf = assert(util.fdopen(fd, "r"))
+      local writef = assert(util.fdopen(fd, "w"))
       writef:setvbuf("no")
       return readf, writef
     end
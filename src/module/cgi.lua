@@ -1,38 +1,385 @@
 local mod = {}
 
-local function run(self, path)
-  local f = io.popen(path)
-  if f then
-    while true do
-      -- 6.2.  Response Types
-      -- https://tools.ietf.org/html/rfc3875#section-6.2
-      local header = f:read("*l")
-      if not header or #header == 0 then
-        break
-      end
-      local key, value = header:match("([%a-]+)%s*:%s*(.+)")
+local config = require("config")
+local cutil = require("cutil")
+local errno = require("posix.errno")
+local poll = require("posix.poll")
+local signal = require("posix.signal")
+local socket = require("posix.sys.socket")
+local stdlib = require("posix.stdlib")
+local unistd = require("posix.unistd")
+local wait = require("posix.sys.wait")
+local util = require("util")
+
+-- Request and response bodies are copied in blocks of this size.
+local BLOCK_SIZE = 65536
+
+--[[
+4.1.  Request Meta-Variables
+https://tools.ietf.org/html/rfc3875#section-4.1
+
+Return the meta-variables as an array of {name, value} pairs.
+--]]
+local function meta_variables(self, path)
+  local request = self.request
+  local headers = request.headers
+  local query_string = request.uri:match("%?(.*)$") or ""
+  local listen_port = self.listen_address and self.listen_address:match(":(%d+)$") or ""
+  local server_name = (headers["host"] or ""):match("^([^:]*)")
+  local vars = {
+    {"GATEWAY_INTERFACE", "CGI/1.1"},
+    {"SERVER_SOFTWARE", "modserver"},
+    {"SERVER_PROTOCOL", request.version or "HTTP/1.1"},
+    {"SERVER_NAME", server_name},
+    {"SERVER_PORT", listen_port},
+    {"REQUEST_METHOD", request.method},
+    {"REQUEST_URI", request.uri},
+    {"SCRIPT_NAME", request.uri_path},
+    {"SCRIPT_FILENAME", path},
+    {"PATH_INFO", ""},
+    {"QUERY_STRING", query_string},
+  }
+  if self.client_address and self.client_address.addr then
+    table.insert(vars, {"REMOTE_ADDR", self.client_address.addr})
+    table.insert(vars, {"REMOTE_PORT", tostring(self.client_address.port)})
+  end
+  if headers["content-length"] then
+    table.insert(vars, {"CONTENT_LENGTH", headers["content-length"]})
+  end
+  if headers["content-type"] then
+    table.insert(vars, {"CONTENT_TYPE", headers["content-type"]})
+  end
+  for name, value in pairs(headers) do
+    -- A Proxy header would become HTTP_PROXY, which scripts take as their proxy (httpoxy).
+    if name ~= "content-length" and name ~= "content-type" and name ~= "proxy" then
+      table.insert(vars, {"HTTP_" .. name:upper():gsub("-", "_"), value})
+    end
+  end
+  local path_env = os.getenv("PATH")
+  if path_env then
+    table.insert(vars, {"PATH", path_env})
+  end
+  return vars
+end
+
+local function content_length(self)
+  return tonumber(self.request.headers["content-length"]) or 0
+end
+
+--[[
+6.  CGI Response
+https://tools.ietf.org/html/rfc3875#section-6
+
+Parse the response header fields as the script writes them and pass the body straight
+through to the user.
+--]]
+local function new_response_parser(self)
+  local parser = {header = "", body = false}
+
+  local function set_headers(header)
+    local status
+    local location = false
+    for line in header:gmatch("([^\n]*)\n") do
+      local key, value = line:gsub("\r$", ""):match("^([%a%d-]+)%s*:%s*(.*)$")
       if key and value then
-        self:set_header(key, value)
+        local lower_key = key:lower()
+        if lower_key == "status" then
+          status = tonumber(value:match("^(%d+)"))
+        else
+          if lower_key == "location" then
+            location = true
+          end
+          self:set_header(key, value)
+        end
+      end
+    end
+    if status then
+      self:set_status(status)
+    elseif location then
+      -- 6.2.3.  Client Redirect Response
+      self:set_status(302)
+    end
+  end
+
+  function parser.feed(data)
+    if parser.body then
+      self:rwrite(data)
+      return
+    end
+    parser.header = parser.header .. data
+    local header_end, body_start = parser.header:find("\r?\n\r?\n")
+    if header_end then
+      local header = parser.header:sub(1, header_end - 1) .. "\n"
+      local body = parser.header:sub(body_start + 1)
+      parser.header = nil
+      parser.body = true
+      set_headers(header)
+      if #body > 0 then
+        self:rwrite(body)
+      end
+    end
+  end
+
+  function parser.finish()
+    if not parser.body and #parser.header > 0 then
+      -- The script never ended its header. Treat what it wrote as the header.
+      set_headers(parser.header .. "\n")
+    end
+  end
+
+  return parser
+end
+
+--[[
+Copy the request body to write_fd and the output of read_fd to the user at the same time.
+Waiting on both descriptors keeps a script that writes output before reading all of its
+input from deadlocking against the server. The two descriptors are the same for a socket.
+Return false if the script did nothing for cgi_timeout seconds.
+--]]
+local function exchange(self, write_fd, read_fd, prefix)
+  local timeout = config.cfg.cgi_timeout > 0 and config.cfg.cgi_timeout * 1000 or -1
+  local timed_out = false
+  local parser = new_response_parser(self)
+  local pending = prefix or ""
+  local remaining = content_length(self)
+  local writing = true
+  util.set_nonblocking(write_fd)
+  util.set_nonblocking(read_fd)
+  while true do
+    if writing and #pending == 0 then
+      if remaining > 0 then
+        pending = self.clientfd_read:read(math.min(BLOCK_SIZE, remaining)) or ""
+        remaining = #pending > 0 and remaining - #pending or 0
+      end
+      if #pending == 0 then
+        writing = false
+        if write_fd ~= read_fd then
+          unistd.close(write_fd)
+        end
+      end
+    end
+    local poll_fds = {[read_fd] = {events = {IN = true}}}
+    if writing then
+      poll_fds[write_fd] = poll_fds[write_fd] or {events = {}}
+      poll_fds[write_fd].events.OUT = true
+    end
+    local ret, _, errnum = poll.poll(poll_fds, timeout)
+    if not ret and errnum ~= errno.EINTR then
+      break
+    end
+    if ret == 0 then
+      timed_out = true
+      break
+    end
+    if ret and ret > 0 then
+      local revents = poll_fds[read_fd].revents
+      if revents.IN or revents.HUP or revents.ERR then
+        local data, _, read_errnum = unistd.read(read_fd, BLOCK_SIZE)
+        if data and #data > 0 then
+          parser.feed(data)
+        elseif read_errnum ~= errno.EAGAIN and read_errnum ~= errno.EINTR then
+          -- The script closed its output.
+          break
+        end
+      end
+      if writing then
+        local write_revents = poll_fds[write_fd].revents
+        if write_revents.OUT then
+          local written = unistd.write(write_fd, pending)
+          if written then
+            pending = pending:sub(written + 1)
+          end
+        elseif write_revents.HUP or write_revents.ERR then
+          -- The script exited without reading all of its input.
+          writing = false
+          if write_fd ~= read_fd then
+            unistd.close(write_fd)
+          end
+        end
+      end
+    end
+  end
+  if writing and write_fd ~= read_fd then
+    unistd.close(write_fd)
+  end
+  if timed_out then
+    return false
+  end
+  parser.finish()
+  return true
+end
+
+local function new_pipe()
+  local read_fd, write_fd = assert(unistd.pipe())
+  util.set_close_on_exec(read_fd)
+  util.set_close_on_exec(write_fd)
+  return read_fd, write_fd
+end
+
+--[[
+Run the script once for this request. The script is started directly with posix_spawn()
+rather than through /bin/sh.
+--]]
+local function run(self, path)
+  local env = {}
+  for _, var in ipairs(meta_variables(self, path)) do
+    table.insert(env, var[1] .. "=" .. var[2])
+  end
+  local stdin_read, stdin_write = new_pipe()
+  local stdout_read, stdout_write = new_pipe()
+  local pid, errmsg = cutil.spawn(path, {path}, env, stdin_read, stdout_write)
+  unistd.close(stdin_read)
+  unistd.close(stdout_write)
+  if not pid then
+    unistd.close(stdin_write)
+    unistd.close(stdout_read)
+    error(("unable to run %s: %s"):format(path, errmsg))
+  end
+  local ok = exchange(self, stdin_write, stdout_read)
+  unistd.close(stdout_read)
+  if not ok then
+    signal.kill(pid, signal.SIGKILL)
+  end
+  wait.wait(pid)
+  if not ok then
+    error(("%s timed out"):format(path))
+  end
+end
+
+--[[
+A persistent script is started once per child process and handles many requests using
+the SCGI protocol: https://python.ca/scgi/protocol.txt
+
+As with FastCGI, the script is started with a listening socket as its standard input.
+The script calls accept() on it for each request, reads the request headers and body,
+writes a CGI response, and closes the connection. The socket is created in a new directory
+that only the server user can enter so no other user can connect to it or take its name.
+--]]
+local function new_persistent_script(path)
+  local script = {path = path}
+
+  local function stop(sig)
+    if script.pid then
+      signal.kill(script.pid, sig or signal.SIGTERM)
+      wait.wait(script.pid)
+      script.pid = nil
+    end
+    if script.socket_path then
+      os.remove(script.socket_path)
+      unistd.rmdir(script.socket_dir)
+      script.socket_path = nil
+    end
+  end
+
+  local function start()
+    local tmpdir = os.getenv("TMPDIR") or "/tmp"
+    local dir, errmsg = stdlib.mkdtemp(tmpdir .. "/modserver-XXXXXX")
+    if not dir then
+      error(("unable to start %s: %s"):format(path, errmsg))
+    end
+    script.socket_dir = dir
+    script.socket_path = dir .. "/scgi.sock"
+    local fd = assert(socket.socket(socket.AF_UNIX, socket.SOCK_STREAM, 0))
+    util.set_close_on_exec(fd)
+    local address = {family = socket.AF_UNIX, path = script.socket_path}
+    local ok
+    ok, errmsg = socket.bind(fd, address)
+    if ok then
+      ok, errmsg = socket.listen(fd, 128)
+    end
+    if ok then
+      -- The request meta-variables are sent with each request instead.
+      local env = {"PATH=" .. (os.getenv("PATH") or "/usr/bin:/bin")}
+      -- The script is stopped with the child process, even one that crashes.
+      script.pid, errmsg = cutil.spawn(path, {path}, env, fd, 1, signal.SIGTERM)
+      ok = script.pid ~= nil
+    end
+    unistd.close(fd)
+    if not ok then
+      stop()
+      error(("unable to start %s: %s"):format(path, errmsg))
+    end
+  end
+
+  local function connect()
+    if script.pid then
+      -- Start the script again if it exited since the last request.
+      local pid = wait.wait(script.pid, wait.WNOHANG)
+      if pid == script.pid then
+        script.pid = nil
+        stop()
       end
     end
-    while true do
-      local body = f:read(4096)
-      if not body then
-        break
+    if not script.pid then
+      start()
+    end
+    local fd = assert(socket.socket(socket.AF_UNIX, socket.SOCK_STREAM, 0))
+    util.set_close_on_exec(fd)
+    local ok, errmsg = socket.connect(fd, {family = socket.AF_UNIX, path = script.socket_path})
+    if not ok then
+      unistd.close(fd)
+      return nil, errmsg
+    end
+    return fd
+  end
+
+  --[[
+  The request headers are sent as a netstring. CONTENT_LENGTH must come first.
+  --]]
+  local function netstring_headers(self)
+    local fields = {
+      "CONTENT_LENGTH", tostring(content_length(self)),
+      "SCGI", "1",
+    }
+    for _, var in ipairs(meta_variables(self, path)) do
+      if var[1] ~= "CONTENT_LENGTH" then
+        table.insert(fields, var[1])
+        table.insert(fields, var[2])
       end
-      self:rwrite(body)
     end
-    f:close()
+    local str = table.concat(fields, "\0") .. "\0"
+    return ("%d:%s,"):format(#str, str)
+  end
+
+  function script.run(self)
+    local fd, errmsg = connect()
+    if not fd then
+      -- The script may have closed its socket. Start it again once.
+      stop()
+      fd = assert(connect())
+    end
+    local ok = exchange(self, fd, fd, netstring_headers(self))
+    unistd.close(fd)
+    if not ok then
+      -- The script is stuck. Start it again on the next request.
+      stop(signal.SIGKILL)
+      error(("%s timed out"):format(path))
+    end
   end
+
+  script.stop = stop
+  return script
 end
 
 function mod.load_servlet(path)
   local servlet = {}
-  
-  function servlet:run()
-    run(self, path)
+
+  if path:match("%.scgi$") then
+    local script = new_persistent_script(path)
+
+    function servlet:run()
+      script.run(self)
+    end
+
+    function servlet.cleanup()
+      script.stop()
+    end
+  else
+    function servlet:run()
+      run(self, path)
+    end
   end
-  
+
   return servlet
 end
 
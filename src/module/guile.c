@@ -7,14 +7,36 @@
 #include <lauxlib.h>
 #include <lua.h>
 #include <lualib.h>
+#include "luacompat.h"
 // Guile Scheme
 #include <libguile.h>
 // Local
 #include "modserver.h"
 
+#define GUILE_SERVLET "module.guile.servlet"
+
+/*
+Servlets receive a handle to the servlet being served. The handle is one foreign pointer
+per process that points to current_servlet, so no object is allocated per request. The
+pointer is cleared between requests so a handle kept by a servlet raises an error instead
+of crashing.
+*/
+static servlet *current_servlet;
+static SCM servlet_handle;
+
+static servlet* get_servlet(SCM s_)
+{
+  servlet **ref = scm_to_pointer(s_);
+  if (!*ref)
+  {
+    scm_misc_error("modserver", "the servlet is used outside of a request", SCM_EOL);
+  }
+  return *ref;
+}
+
 static SCM api_get_arg(SCM s_, SCM name_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   char *name = scm_to_utf8_string(name_);
   const char *arg = get_arg(s, name);
   free(name);
@@ -27,7 +49,7 @@ static SCM api_get_arg(SCM s_, SCM name_)
 
 static SCM api_get_method(SCM s_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   const char *method = get_method(s);
   if (method)
   {
@@ -38,7 +60,7 @@ static SCM api_get_method(SCM s_)
 
 static SCM api_get_header(SCM s_, SCM key_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   char *key = scm_to_utf8_string(key_);
   const char *value = get_header(s, key);
   free(key);
@@ -51,7 +73,7 @@ static SCM api_get_header(SCM s_, SCM key_)
 
 static SCM api_set_status(SCM s_, SCM status_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   int status = scm_to_int(status_);
   set_status(s, status);
   return SCM_UNSPECIFIED;
@@ -59,7 +81,7 @@ static SCM api_set_status(SCM s_, SCM status_)
 
 static SCM api_set_header(SCM s_, SCM key_, SCM value_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   char *key = scm_to_utf8_string(key_);
   char *value = scm_to_utf8_string(value_);
   set_header(s, key, value);
@@ -70,7 +92,7 @@ static SCM api_set_header(SCM s_, SCM key_, SCM value_)
 
 static SCM api_rwrite(SCM s_, SCM buffer_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   size_t length;
   char *str = scm_to_utf8_stringn(buffer_, &length);
   size_t ret = rwrite(s, str, length);
@@ -80,52 +102,104 @@ static SCM api_rwrite(SCM s_, SCM buffer_)
 
 static SCM api_rflush(SCM s_)
 {
-  servlet *s = scm_to_pointer(s_);
+  servlet *s = get_servlet(s_);
   rflush(s);
   return SCM_UNSPECIFIED;
 }
 
-static void* guile_mod_init(void *data)
+/*
+Define the API once in the (modserver) module. Each servlet module uses it.
+*/
+static void init_api_module(void *data)
 {
-  return NULL;
+  scm_c_define_gsubr("get_arg", 2, 0, 0, &api_get_arg);
+  scm_c_define_gsubr("get_method", 1, 0, 0, &api_get_method);
+  scm_c_define_gsubr("get_header", 2, 0, 0, &api_get_header);
+  scm_c_define_gsubr("set_status", 2, 0, 0, &api_set_status);
+  scm_c_define_gsubr("set_header", 3, 0, 0, &api_set_header);
+  scm_c_define_gsubr("rwrite", 2, 0, 0, &api_rwrite);
+  scm_c_define_gsubr("rflush", 1, 0, 0, &api_rflush);
+  scm_c_export("get_arg", "get_method", "get_header", "set_status", "set_header",
+    "rwrite", "rflush", NULL);
 }
 
 static int mod_init(lua_State *l)
 {
   scm_init_guile();
+  scm_c_define_module("modserver", init_api_module, NULL);
+  servlet_handle = scm_gc_protect_object(scm_from_pointer(&current_servlet, NULL));
   return 0;
 }
 
+/*
+Print an uncaught Scheme error instead of letting it terminate the process.
+*/
+static SCM print_error(void *data, SCM key, SCM args)
+{
+  SCM port = scm_current_error_port();
+  scm_display(scm_from_utf8_string((const char*)data), port);
+  scm_display(scm_from_utf8_string(": "), port);
+  scm_write(scm_cons(key, args), port);
+  scm_newline(port);
+  return SCM_BOOL_F;
+}
+
+static SCM call_run(void *data)
+{
+  return scm_call_1(*(SCM*)data, servlet_handle);
+}
+
 static int servlet_run(lua_State *l)
 {
-  SCM run_ref = (SCM)lua_touserdata(l, lua_upvalueindex(1));
-  SCM s = scm_from_pointer(l, NULL);
-  scm_call_1(run_ref, s);
+  SCM *run = luaL_checkudata(l, lua_upvalueindex(1), GUILE_SERVLET);
+  current_servlet = (servlet*)l;
+  scm_internal_catch(SCM_BOOL_T, call_run, run, print_error, (void*)"run");
+  current_servlet = NULL;
   return 0;
 }
 
+static int guile_servlet_gc(lua_State *l)
+{
+  SCM *run = luaL_checkudata(l, 1, GUILE_SERVLET);
+  scm_gc_unprotect_object(*run);
+  return 0;
+}
+
+static void init_servlet_module(void *data)
+{
+  scm_c_use_module("modserver");
+}
+
+/*
+load-in-vicinity is what load uses. It compiles the servlet to a .go file in the
+compiled-file cache the first time and loads the cached file while the servlet is
+unmodified. The file is evaluated when it cannot be compiled.
+*/
+static SCM load_servlet(void *data)
+{
+  const char *path = data;
+  SCM load_in_vicinity = scm_c_public_ref("guile", "load-in-vicinity");
+  scm_call_2(load_in_vicinity, scm_getcwd(), scm_from_utf8_string(path));
+  return scm_variable_ref(scm_c_lookup("run"));
+}
+
 static int mod_load_servlet(lua_State *l)
 {
   const char *path = luaL_checkstring(l, -1);
-  SCM module = scm_c_define_module(path, NULL, NULL);
+  SCM module = scm_c_define_module(path, init_servlet_module, NULL);
   SCM prev_module = scm_set_current_module(module);
-  
-  // TODO: don't define these functions every time for each servlet
-  scm_c_define_gsubr("get_arg", 2, 0, 0, &api_get_arg);
-  scm_c_define_gsubr("get_method", 1, 0, 0, &api_get_method);
-  scm_c_define_gsubr("get_header", 2, 0, 0, &api_get_header);
-  scm_c_define_gsubr("set_status", 2, 0, 0, &api_set_status);
-  scm_c_define_gsubr("set_header", 3, 0, 0, &api_set_header);
-  scm_c_define_gsubr("rwrite", 2, 0, 0, &api_rwrite);
-  scm_c_define_gsubr("rflush", 1, 0, 0, &api_rflush);
-  
-  SCM foo = scm_c_primitive_load(path);
-  SCM run_symbol = scm_c_lookup("run");
-  SCM run_ref = scm_variable_ref(run_symbol);
+  SCM run = scm_internal_catch(SCM_BOOL_T, load_servlet, (void*)path, print_error,
+    (void*)"load_servlet");
   scm_set_current_module(prev_module);
+  if (scm_is_false(scm_procedure_p(run)))
+  {
+    return luaL_error(l, "the servlet does not define run: %s", path);
+  }
   
   lua_newtable(l);
-  lua_pushlightuserdata(l, (void*)run_ref);
+  SCM *ud = lua_newuserdata(l, sizeof(SCM));
+  *ud = scm_gc_protect_object(run);
+  luaL_setmetatable(l, GUILE_SERVLET);
   lua_pushcclosure(l, servlet_run, 1);
   lua_setfield(l, -2, "run");
   
@@ -147,6 +221,10 @@ static const luaL_Reg module_guile[] =
 
 LUALIB_API int luaopen_module_guile(lua_State *l)
 {
+  luaL_newmetatable(l, GUILE_SERVLET);
+  lua_pushcfunction(l, guile_servlet_gc);
+  lua_setfield(l, -2, "__gc");
+  lua_pop(l, 1);
   luaL_newlib(l, module_guile);
   return 1;
 }
@@ -158,4 +236,5 @@ LUALIB_API int luaopen_module_guile(lua_State *l)
 // http://www.lonelycactus.com/guilebook/seccreatingguiletoplevelvar.html
 // http://www.lonelycactus.com/guilebook/secreadtoplevel.html
 // http://agentzh.org/misc/code/gdb/guile/guile.c.html
+// https://www.gnu.org/software/guile/manual/html_node/Compilation.html
 // /usr/include/guile/2.0/libguile/modules.h
@@ -1,7 +1,80 @@
 local mod = {}
 
-function mod.load_servlet(path)
+local cutil = require("cutil")
+local stat = require("posix.sys.stat")
+local stdlib = require("posix.stdlib")
+local unistd = require("posix.unistd")
+
+--[[
+A servlet listed in EMBED_SERVLETS in the Makefile is compiled into the server binary. 
+luastatic adds the searcher for embedded files after the package.preload searcher. The 
+searchers that load from the file system also return the file name. LuaJIT calls the 
+searchers package.loaders.
+--]]
+local function load_embedded(path)
+  local name = path:gsub("%.lua$", ""):gsub("/", ".")
+  local searchers = package.searchers or package.loaders
+  local loader, filename = searchers[2](name)
+  if type(loader) == "function" and filename == nil then
+    return loader
+  end
+end
+
+--[[
+The cache entry for a servlet starts with a line identifying the version of the source 
+file it was compiled from. The name of the entry is the escaped real path of the source. 
+Bytecode is not verified when it is loaded, so an entry is only used if no other user 
+could have written it. See config.lua_bytecode_cache().
+--]]
+local function load_cached(path, cache)
+  local stat_tbl = stat.stat(path)
+  local realpath = stdlib.realpath(path)
+  if not stat_tbl or not realpath then
+    return assert(loadfile(path))
+  end
+  local key = ("modserver %d %d %d %s\n"):format(
+    stat_tbl.st_mtime, stat_tbl.st_size, stat_tbl.st_ino, cache.strip and "strip" or ""
+  )
+  local cache_path = cache.dir .. "/" .. realpath:gsub("[^%w._-]", function(c)
+    return ("%%%02X"):format(c:byte())
+  end) .. "c"
+  local data = cutil.read_private(cache_path)
+  if data and data:sub(1, #key) == key then
+    local chunk = load(data:sub(#key + 1), "@" .. path, "b")
+    if chunk then
+      return chunk
+    end
+  end
   local chunk = assert(loadfile(path))
+  -- Write to a temporary file and rename it so that no process reads a partial entry.
+  local tmp_path = ("%s.%d"):format(cache_path, unistd.getpid())
+  local file = io.open(tmp_path, "wb")
+  if file then
+    local ok = file:write(key, cutil.dump(chunk, cache.strip))
+    file:close()
+    -- A umask that lets the group write would make read_private() refuse the entry.
+    ok = ok and stat.chmod(tmp_path, tonumber("600", 8))
+    if not (ok and os.rename(tmp_path, cache_path)) then
+      os.remove(tmp_path)
+    end
+  end
+  return chunk
+end
+
+local function load_chunk(path)
+  local chunk = load_embedded(path)
+  if chunk then
+    return chunk
+  end
+  local cache = require("config").cfg.lua_bytecode_cache
+  if cache and not path:match("%.luac$") then
+    return load_cached(path, cache)
+  end
+  return assert(loadfile(path))
+end
+
+function mod.load_servlet(path)
+  local chunk = load_chunk(path)
   local servlet = chunk()
   assert(servlet.run, "The servlet must have a run() function: " .. path)
   return servlet
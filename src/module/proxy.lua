@@ -0,0 +1,525 @@
+--[[
+The proxy module forwards requests to upstream HTTP servers. It is used through the
+proxy_pass directive in the config file rather than by loading servlets from files.
+
+Each child process keeps a pool of idle keep-alive connections to each upstream. Request
+and response bodies are copied in blocks as they arrive and never fully buffered.
+--]]
+local mod = {}
+
+local cutil = require("cutil")
+local errno = require("posix.errno")
+local http = require("http")
+local poll = require("posix.poll")
+local socket = require("posix.sys.socket")
+local unistd = require("posix.unistd")
+local util = require("util")
+
+-- Request and response bodies are copied in blocks of this size.
+local BLOCK_SIZE = 65536
+
+--[[
+Hop-by-hop headers apply to a single connection and are not forwarded.
+https://tools.ietf.org/html/rfc7230#section-6.1
+--]]
+local HOP_BY_HOP_HEADERS = {
+  ["connection"] = true,
+  ["keep-alive"] = true,
+  ["proxy-authenticate"] = true,
+  ["proxy-authorization"] = true,
+  ["proxy-connection"] = true,
+  ["te"] = true,
+  ["trailer"] = true,
+  ["transfer-encoding"] = true,
+  ["upgrade"] = true,
+  -- The server answers 100-continue itself before the servlet runs.
+  ["expect"] = true,
+}
+
+local function is_hop_by_hop(headers, name)
+  if HOP_BY_HOP_HEADERS[name] then
+    return true
+  end
+  -- Headers listed in the Connection header are hop-by-hop too.
+  local connection = headers["connection"]
+  if connection then
+    for token in connection:lower():gmatch("[^%s,]+") do
+      if token == name then
+        return true
+      end
+    end
+  end
+  return false
+end
+
+--[[
+Resolve an upstream address of the form "host:port" or "unix:/path/to/socket". Addresses
+are resolved once when the config file is loaded.
+--]]
+local function resolve(str)
+  local path = str:match("^unix:(.+)$")
+  if path then
+    return {name = str, address = {family = socket.AF_UNIX, path = path}}
+  end
+  local host, port = str:match("^%[?(.-)%]?:(%d+)$")
+  port = assert(tonumber(port), "the upstream port must be a number: " .. str)
+  local addrinfo = assert(socket.getaddrinfo(host, port, {
+    family = socket.AF_UNSPEC, socktype = socket.SOCK_STREAM}
+  ))
+  local address = {family = addrinfo[1].family, addr = addrinfo[1].addr, port = port}
+  return {name = str, host = str, address = address}
+end
+
+local function write_all(fd, data)
+  local offset = 1
+  while offset <= #data do
+    local written, errmsg, errnum = unistd.write(fd, data:sub(offset))
+    if not written then
+      if errnum ~= errno.EINTR then
+        return nil, errmsg, errnum
+      end
+    else
+      offset = offset + written
+    end
+  end
+  return true
+end
+
+--[[
+Return true if an idle connection was closed by the upstream. An idle connection has
+nothing to read, so a readable connection is either closed or out of sync.
+--]]
+local function is_stale(connection)
+  local poll_fds = {[connection.fd] = {events = {IN = true}}}
+  local ret = poll.poll(poll_fds, 0)
+  if not ret then
+    return true
+  end
+  local revents = poll_fds[connection.fd].revents
+  return ret > 0 and (revents.IN or revents.HUP or revents.ERR) and true or false
+end
+
+local function close_connection(connection)
+  connection.file:close()
+end
+
+--[[
+Connect to the upstream. The send timeout also bounds the time connect() may block.
+--]]
+local function open_connection(upstream, options)
+  local address = upstream.address
+  local fd, errmsg, errnum = socket.socket(address.family, socket.SOCK_STREAM, 0)
+  if not fd then
+    return nil, errmsg, errnum
+  end
+  util.set_close_on_exec(fd)
+  socket.setsockopt(fd, socket.SOL_SOCKET, socket.SO_SNDTIMEO, options.connect_timeout, 0)
+  local ok
+  ok, errmsg, errnum = socket.connect(fd, address)
+  if not ok then
+    unistd.close(fd)
+    return nil, errmsg, errnum
+  end
+  if address.family ~= socket.AF_UNIX then
+    socket.setsockopt(fd, socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+  end
+  socket.setsockopt(fd, socket.SOL_SOCKET, socket.SO_SNDTIMEO, options.timeout, 0)
+  socket.setsockopt(fd, socket.SOL_SOCKET, socket.SO_RCVTIMEO, options.timeout, 0)
+  local file = assert(util.fdopen(fd, "r"))
+  return {fd = fd, file = file, upstream = upstream, reused = false}
+end
+
+--[[
+Choose an upstream for the next request.
+
+round_robin: each upstream in turn.
+least_conn: the upstream with the fewest requests in progress across all children.
+
+The counters live in shared memory so the choice is made across all children, not just
+within one. Counters of a child that crashes mid-request are not decremented; the error
+only skews least_conn toward other upstreams.
+--]]
+local function new_balancer(upstreams, method)
+  assert(method == "round_robin" or method == "least_conn",
+    "the balance option must be round_robin or least_conn")
+  -- Slot 1 is the round-robin position. Slot i + 1 counts the requests to upstream i.
+  local counters = assert(cutil.shared_counters(#upstreams + 1))
+  local balancer = {}
+
+  function balancer.pick(attempt)
+    local index
+    if method == "least_conn" and attempt == 1 then
+      local least
+      local start = counters:get(1) % #upstreams
+      for i = 0, #upstreams - 1 do
+        local candidate = (start + i) % #upstreams + 1
+        local active = counters:get(candidate + 1)
+        if not least or active < least then
+          index, least = candidate, active
+        end
+      end
+      counters:add(1, 1)
+    else
+      index = (counters:add(1, 1) - 1) % #upstreams + 1
+    end
+    return index, upstreams[index]
+  end
+
+  function balancer.acquire(index)
+    counters:add(index + 1, 1)
+  end
+
+  function balancer.release(index)
+    counters:add(index + 1, -1)
+  end
+
+  return balancer
+end
+
+local function request_head(self, options, upstream)
+  local request = self.request
+  local uri = request.uri
+  if options.uri then
+    uri = options.uri .. (request.uri:match("(%?.*)$") or "")
+  end
+  local lines = {("%s %s HTTP/1.1\r\n"):format(request.method, uri)}
+  local headers = request.headers
+  for name, value in pairs(headers) do
+    if not is_hop_by_hop(headers, name) and name ~= "x-forwarded-for" then
+      table.insert(lines, ("%s: %s\r\n"):format(name, value))
+    end
+  end
+  if not headers["host"] and upstream.host then
+    table.insert(lines, ("host: %s\r\n"):format(upstream.host))
+  end
+  local client_address = self.client_address and self.client_address.addr
+  if client_address then
+    local forwarded_for = headers["x-forwarded-for"]
+    if forwarded_for then
+      forwarded_for = forwarded_for .. ", " .. client_address
+    else
+      forwarded_for = client_address
+    end
+    table.insert(lines, ("x-forwarded-for: %s\r\n"):format(forwarded_for))
+  end
+  table.insert(lines, "connection: keep-alive\r\n\r\n")
+  return table.concat(lines)
+end
+
+--[[
+Read the status line and headers of the upstream response. Informational 1xx responses
+are skipped. Return the status, version, headers in the order received, and a table of
+the lowercase header names.
+--]]
+local function read_response_head(file)
+  while true do
+    local status_line, errmsg, errnum = util.fgets(4096, file)
+    if not status_line then
+      return nil, errmsg, errnum
+    end
+    local version, status = status_line:match("^HTTP/(%d+%.%d+)%s+(%d%d%d)")
+    status = tonumber(status)
+    if not status then
+      return nil, "invalid status line from upstream"
+    end
+    local header_list = {}
+    local headers = {}
+    while true do
+      local header
+      header, errmsg, errnum = util.fgets(4096, file)
+      if not header then
+        return nil, errmsg, errnum
+      end
+      if header == "\r\n" or header == "\n" then
+        break
+      end
+      local name, value = http.parse_header(header)
+      if name then
+        name = name:lower()
+        table.insert(header_list, {name = name, value = value})
+        headers[name] = value
+      end
+    end
+    if status >= 200 or status < 100 then
+      return status, version, header_list, headers
+    end
+  end
+end
+
+--[[
+Copy the request body to the upstream as it is read from the user.
+--]]
+local function send_request_body(self, fd)
+  local remaining = tonumber(self.request.headers["content-length"]) or 0
+  while remaining > 0 do
+    local data = self.clientfd_read:read(math.min(BLOCK_SIZE, remaining))
+    if not data or #data == 0 then
+      return nil, "the request body ended early"
+    end
+    remaining = remaining - #data
+    local ok, errmsg, errnum = write_all(fd, data)
+    if not ok then
+      return nil, errmsg, errnum
+    end
+  end
+  return true
+end
+
+--[[
+rwrite() returns the number of bytes written or an error message.
+--]]
+local function rwrite(self, data)
+  local written = self:rwrite(data)
+  if type(written) ~= "number" then
+    error(written or "unable to write the response")
+  end
+end
+
+local function read_block(file, length)
+  local data = file:read(length)
+  if not data or #data == 0 then
+    error("the upstream response ended early")
+  end
+  return data
+end
+
+--[[
+Copy the response body to the user. Return true if the connection can be reused.
+--]]
+local function copy_response_body(self, connection, status, headers)
+  local file = connection.file
+  if self.request.method == "HEAD" or status == 204 or status == 304 then
+    return true
+  end
+  local transfer_encoding = headers["transfer-encoding"]
+  if transfer_encoding and transfer_encoding:lower():match("chunked") then
+    --[[
+    4.1.  Chunked Transfer Coding
+    https://tools.ietf.org/html/rfc7230#section-4.1
+    The chunks are decoded here and chunked again by rwrite() toward the user.
+    --]]
+    while true do
+      local size_line = assert(util.fgets(4096, file), "the upstream response ended early")
+      local size = tonumber(size_line:match("^%x+"), 16)
+      assert(size, "invalid chunk size from upstream")
+      if size == 0 then
+        -- Skip the trailer.
+        repeat
+          local line = assert(util.fgets(4096, file), "the upstream response ended early")
+        until line == "\r\n" or line == "\n"
+        return true
+      end
+      while size > 0 do
+        local data = read_block(file, math.min(BLOCK_SIZE, size))
+        size = size - #data
+        rwrite(self, data)
+      end
+      util.fgets(4096, file)
+    end
+  end
+  local content_length = tonumber(headers["content-length"])
+  if content_length then
+    local remaining = content_length
+    while remaining > 0 do
+      local data = read_block(file, math.min(BLOCK_SIZE, remaining))
+      remaining = remaining - #data
+      rwrite(self, data)
+    end
+    return true
+  end
+  -- The body ends when the upstream closes the connection.
+  while true do
+    local data = file:read(BLOCK_SIZE)
+    if not data or #data == 0 then
+      return false
+    end
+    rwrite(self, data)
+  end
+end
+
+local function set_response_headers(self, status, header_list, headers)
+  self:set_status(status)
+  for _, header in ipairs(header_list) do
+    local name = header.name
+    if not is_hop_by_hop(headers, name) then
+      local existing = self.response_headers[name]
+      if existing and name == "set-cookie" then
+        if type(existing.value) ~= "table" then
+          existing.value = {existing.value}
+        end
+        table.insert(existing.value, header.value)
+      else
+        self:set_header(name, header.value)
+      end
+    end
+  end
+  if not headers["content-length"] and (status == 204 or status == 304) then
+    self:set_header("Content-Length", "0")
+  end
+  self:write_status_line_and_headers()
+end
+
+local function keep_alive(version, headers)
+  local connection = (headers["connection"] or ""):lower()
+  if version == "1.0" then
+    return connection:match("keep%-alive") ~= nil
+  end
+  return connection:match("close") == nil
+end
+
+--[[
+Create a servlet that forwards requests to a list of upstreams.
+
+options:
+  balance: "round_robin" (default) or "least_conn".
+  connect_timeout: seconds to wait for a connection. Defaults to 5.
+  timeout: seconds to wait on each read or write to the upstream. Defaults to 60.
+  keepalive: idle connections kept per upstream in each child. Defaults to 8.
+  uri: forward to this path instead of the path of the request.
+--]]
+function mod.new_servlet(upstreams, options)
+  if type(upstreams) == "string" then
+    upstreams = {upstreams}
+  end
+  assert(#upstreams > 0, "proxy_pass needs at least one upstream")
+  options = options or {}
+  options.connect_timeout = options.connect_timeout or 5
+  options.timeout = options.timeout or 60
+  options.keepalive = options.keepalive or 8
+  local resolved = {}
+  for i, upstream in ipairs(upstreams) do
+    resolved[i] = resolve(upstream)
+    resolved[i].idle = {}
+  end
+  local balancer = new_balancer(resolved, options.balance or "round_robin")
+  local servlet = {}
+
+  local function get_connection(upstream, allow_reuse)
+    if allow_reuse then
+      while #upstream.idle > 0 do
+        local connection = table.remove(upstream.idle)
+        if not is_stale(connection) then
+          connection.reused = true
+          return connection
+        end
+        close_connection(connection)
+      end
+    end
+    return open_connection(upstream, options)
+  end
+
+  local function put_connection(connection)
+    local idle = connection.upstream.idle
+    if #idle < options.keepalive then
+      table.insert(idle, connection)
+    else
+      close_connection(connection)
+    end
+  end
+
+  --[[
+  Send the request and read the response head. A reused connection may have been closed
+  by the upstream at any time, so the request is sent again on a new connection if the
+  reused one fails before any of the request body is consumed. The last value returned on
+  failure tells whether the request body was consumed.
+  --]]
+  local function send_request(self, upstream)
+    local head = request_head(self, options, upstream)
+    local has_body = (tonumber(self.request.headers["content-length"]) or 0) > 0
+    local allow_reuse = true
+    while true do
+      local connection, errmsg, errnum = get_connection(upstream, allow_reuse)
+      if not connection then
+        return nil, errmsg, errnum, false
+      end
+      local body_sent = false
+      local ok
+      ok, errmsg, errnum = write_all(connection.fd, head)
+      if ok then
+        body_sent = has_body
+        ok, errmsg, errnum = send_request_body(self, connection.fd)
+      end
+      if ok then
+        local status, version, header_list, headers = read_response_head(connection.file)
+        if status then
+          return connection, status, version, header_list, headers
+        end
+        errmsg, errnum = version, header_list
+      end
+      close_connection(connection)
+      if not connection.reused or body_sent then
+        return nil, errmsg, errnum, body_sent
+      end
+      allow_reuse = false
+    end
+  end
+
+  function servlet.run(self)
+    local headers = self.request.headers
+    if headers["transfer-encoding"] then
+      self:set_status(411)
+      self:rwrite("411 Length Required")
+      return
+    end
+    local connection, status, version, header_list, response_headers
+    local errnum
+    local index, upstream
+    -- Try each upstream in turn until one responds.
+    for attempt = 1, #resolved do
+      index, upstream = balancer.pick(attempt)
+      balancer.acquire(index)
+      connection, status, version, header_list, response_headers =
+        send_request(self, upstream)
+      if connection then
+        break
+      end
+      balancer.release(index)
+      print("proxy:", upstream.name, status)
+      errnum = version
+      if header_list then
+        -- The request body was consumed and cannot be sent again.
+        break
+      end
+    end
+    if not connection then
+      if errnum == errno.EAGAIN or errnum == errno.EWOULDBLOCK
+        or errnum == errno.EINPROGRESS then
+        self:set_status(504)
+        self:rwrite("504 Gateway Timeout")
+      else
+        self:set_status(502)
+        self:rwrite("502 Bad Gateway")
+      end
+      return
+    end
+    local ok, reusable = pcall(function()
+      set_response_headers(self, status, header_list, response_headers)
+      return copy_response_body(self, connection, status, response_headers)
+    end)
+    balancer.release(index)
+    if ok and reusable and keep_alive(version, response_headers) then
+      put_connection(connection)
+    else
+      close_connection(connection)
+    end
+    if not ok then
+      -- Close the connection to the user so the truncated response is not mistaken for a
+      -- complete one.
+      error(reusable)
+    end
+  end
+
+  return servlet
+end
+
+--[[
+load_module() requires a load_servlet() function. Proxies are configured with proxy_pass
+instead, so there is no file to load.
+--]]
+function mod.load_servlet(path)
+  error("use proxy_pass to configure a proxy: " .. path)
+end
+
+mod.reloadable = false
+
+return mod
@@ -1,202 +1,1428 @@
+// Python must be included before any standard headers.
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
 // C99
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+// POSIX
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 // Lua
 #include <lauxlib.h>
 #include <lua.h>
 #include <lualib.h>
-// Python
-#define PY_SSIZE_T_CLEAN
-#include <Python.h>
+#include "luacompat.h"
 // Local
 #include "modserver.h"
 
-static void pyassert(int success)
+#define PYTHON_SERVLET "module.python.servlet"
+
+/*
+Servlets receive a modserver.Servlet object that wraps the servlet pointer. A single object
+and a single argument tuple are created per process and reused for every request. The
+pointer is set before run() is called and cleared afterward so an object kept by the
+servlet past the end of a request raises an exception instead of crashing.
+*/
+typedef struct
 {
-  if (!success)
+  PyObject_HEAD
+  servlet *s;
+} ServletObject;
+
+static PyTypeObject ServletType;
+static ServletObject *servlet_object;
+static PyObject *run_args;
+static PyObject *source_file_loader;
+
+static servlet* get_servlet(ServletObject *self)
+{
+  if (!self->s)
   {
-    PyErr_Print();
+    PyErr_SetString(PyExc_RuntimeError, "the servlet is used outside of a request");
+  }
+  return self->s;
+}
+
+static int check_nargs(const char *name, Py_ssize_t nargs, Py_ssize_t expected)
+{
+  if (nargs != expected)
+  {
+    PyErr_Format(PyExc_TypeError, "%s() takes %zd arguments (%zd given)", name, expected,
+      nargs);
+    return 0;
   }
+  return 1;
 }
 
-static servlet* get_servlet(PyObject *capsule)
+static PyObject* str_or_none(const char *str)
 {
-  assert(capsule);
-  const char *name = PyCapsule_GetName(capsule);
-  assert(name);
-  servlet *s = PyCapsule_GetPointer(capsule, "servlet*");
-  assert(s);
-  return s;
+  if (str)
+  {
+    return PyUnicode_FromString(str);
+  }
+  Py_RETURN_NONE;
 }
 
-static PyObject* api_get_arg(PyObject *self, PyObject *args)
+static PyObject* servlet_get_arg(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  const char *name;
-  pyassert(PyArg_ParseTuple(args, "Os", &capsule, &name));
-  servlet *s = get_servlet(capsule);
-  const char *value = get_arg(s, name);
-  PyObject *value_obj = Py_BuildValue("s", value);
-  return value_obj;
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("get_arg", nargs, 1))
+  {
+    return NULL;
+  }
+  const char *name = PyUnicode_AsUTF8(args[0]);
+  if (!name)
+  {
+    return NULL;
+  }
+  return str_or_none(get_arg(s, name));
 }
 
-static PyObject* api_get_method(PyObject *self, PyObject *args)
+static PyObject* servlet_get_method(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  pyassert(PyArg_ParseTuple(args, "O", &capsule));
-  servlet *s = get_servlet(capsule);
-  const char *method = get_method(s);
-  PyObject *method_obj = Py_BuildValue("s", method);
-  return method_obj;
+  (void)args;
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("get_method", nargs, 0))
+  {
+    return NULL;
+  }
+  return str_or_none(get_method(s));
 }
 
-static PyObject* api_get_header(PyObject *self, PyObject *args)
+static PyObject* servlet_get_header(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  const char *key;
-  pyassert(PyArg_ParseTuple(args, "Os", &capsule, &key));
-  servlet *s = get_servlet(capsule);
-  const char *value = get_header(s, key);
-  PyObject *value_obj = Py_BuildValue("s", value);
-  return value_obj;
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("get_header", nargs, 1))
+  {
+    return NULL;
+  }
+  const char *key = PyUnicode_AsUTF8(args[0]);
+  if (!key)
+  {
+    return NULL;
+  }
+  return str_or_none(get_header(s, key));
 }
 
-static PyObject* api_set_status(PyObject *self, PyObject *args)
+static PyObject* servlet_set_status(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  int status;
-  pyassert(PyArg_ParseTuple(args, "Oi", &capsule, &status));
-  servlet *s = get_servlet(capsule);
-  set_status(s, status);
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("set_status", nargs, 1))
+  {
+    return NULL;
+  }
+  long status = PyLong_AsLong(args[0]);
+  if (status == -1 && PyErr_Occurred())
+  {
+    return NULL;
+  }
+  set_status(s, (int)status);
   Py_RETURN_NONE;
 }
 
-static PyObject* api_set_header(PyObject *self, PyObject *args)
+static PyObject* servlet_set_header(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  const char *key;
-  const char *value;
-  pyassert(PyArg_ParseTuple(args, "Oss", &capsule, &key, &value));
-  servlet *s = get_servlet(capsule);
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("set_header", nargs, 2))
+  {
+    return NULL;
+  }
+  const char *key = PyUnicode_AsUTF8(args[0]);
+  if (!key)
+  {
+    return NULL;
+  }
+  const char *value = PyUnicode_AsUTF8(args[1]);
+  if (!value)
+  {
+    return NULL;
+  }
   set_header(s, key, value);
   Py_RETURN_NONE;
 }
 
-static PyObject* api_rwrite(PyObject *self, PyObject *args)
+/*
+Get a pointer to the bytes of a str or of any object that supports the buffer protocol,
+such as bytes, bytearray, memoryview, or a contiguous numpy array. Nothing is copied. A str
+is written as UTF-8. Call PyBuffer_Release() on the view when done.
+*/
+static int get_bytes(PyObject *obj, Py_buffer *view)
 {
-  PyObject *capsule;
-  const char *reply;
-  ssize_t length;
-  pyassert(PyArg_ParseTuple(args, "Os#", &capsule, &reply, &length));
-  if (length > 0)
+  if (PyUnicode_Check(obj))
   {
-    servlet *s = get_servlet(capsule);
-    size_t ret = rwrite(s, reply, length);
-    PyObject *ret_obj = Py_BuildValue("#", (size_t)ret);
-    return ret_obj;
+    Py_ssize_t length;
+    const char *str = PyUnicode_AsUTF8AndSize(obj, &length);
+    if (!str)
+    {
+      return 0;
+    }
+    // The UTF-8 form is cached by the str, which the view keeps alive.
+    return PyBuffer_FillInfo(view, obj, (void*)str, length, 1, PyBUF_SIMPLE) == 0;
   }
-  Py_RETURN_NONE;
+  return PyObject_GetBuffer(obj, view, PyBUF_SIMPLE) == 0;
+}
+
+static PyObject* servlet_rwrite(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("rwrite", nargs, 1))
+  {
+    return NULL;
+  }
+  Py_buffer view;
+  if (!get_bytes(args[0], &view))
+  {
+    return NULL;
+  }
+  size_t ret = 0;
+  if (view.len > 0)
+  {
+    ret = rwrite(s, view.buf, view.len);
+  }
+  PyBuffer_Release(&view);
+  return PyLong_FromSize_t(ret);
+}
+
+/*
+Small items are gathered into a buffer of this size and written together. Larger items 
+are written directly.
+*/
+#define RWRITELINES_BUFFER_SIZE 65536
+
+/*
+Write each item of an iterable, such as a list of strings or the body returned by a 
+generator. Return the total number of bytes written.
+*/
+static PyObject* servlet_rwritelines(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("rwritelines", nargs, 1))
+  {
+    return NULL;
+  }
+  PyObject *iterator = PyObject_GetIter(args[0]);
+  if (!iterator)
+  {
+    return NULL;
+  }
+  char *buffer = PyMem_Malloc(RWRITELINES_BUFFER_SIZE);
+  if (!buffer)
+  {
+    Py_DECREF(iterator);
+    return PyErr_NoMemory();
+  }
+  size_t buffered = 0;
+  size_t total = 0;
+  PyObject *item;
+  while ((item = PyIter_Next(iterator)))
+  {
+    Py_buffer view;
+    int ok = get_bytes(item, &view);
+    Py_DECREF(item);
+    if (!ok)
+    {
+      break;
+    }
+    if (buffered + view.len > RWRITELINES_BUFFER_SIZE && buffered > 0)
+    {
+      total += rwrite(s, buffer, buffered);
+      buffered = 0;
+    }
+    if (view.len >= RWRITELINES_BUFFER_SIZE)
+    {
+      total += rwrite(s, view.buf, view.len);
+    }
+    else
+    {
+      memcpy(buffer + buffered, view.buf, view.len);
+      buffered += view.len;
+    }
+    PyBuffer_Release(&view);
+  }
+  if (buffered > 0)
+  {
+    total += rwrite(s, buffer, buffered);
+  }
+  PyMem_Free(buffer);
+  Py_DECREF(iterator);
+  if (PyErr_Occurred())
+  {
+    return NULL;
+  }
+  return PyLong_FromSize_t(total);
+}
+
+// The number of items of a sequence that rwritev() passes to the server in one call.
+#define RWRITEV_BATCH_SIZE 64
+
+/*
+Write the items of a sequence, such as a list of template fragments, as one buffer. Each 
+batch of items is passed to the server with one rwritev() call without being copied. 
+Return the total number of bytes written.
+*/
+static PyObject* servlet_rwritev(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("rwritev", nargs, 1))
+  {
+    return NULL;
+  }
+  PyObject *sequence = PySequence_Fast(args[0], "rwritev() expects a sequence");
+  if (!sequence)
+  {
+    return NULL;
+  }
+  Py_ssize_t length = PySequence_Fast_GET_SIZE(sequence);
+  PyObject **items = PySequence_Fast_ITEMS(sequence);
+  Py_buffer views[RWRITEV_BATCH_SIZE];
+  struct iovec iov[RWRITEV_BATCH_SIZE];
+  size_t total = 0;
+  int ok = 1;
+  for (Py_ssize_t i = 0; ok && i < length; i += RWRITEV_BATCH_SIZE)
+  {
+    int count = 0;
+    while (count < RWRITEV_BATCH_SIZE && i + count < length)
+    {
+      if (!get_bytes(items[i + count], &views[count]))
+      {
+        ok = 0;
+        break;
+      }
+      iov[count].iov_base = views[count].buf;
+      iov[count].iov_len = views[count].len;
+      ++count;
+    }
+    if (ok)
+    {
+      total += rwritev(s, iov, count);
+    }
+    for (int j = 0; j < count; ++j)
+    {
+      PyBuffer_Release(&views[j]);
+    }
+  }
+  Py_DECREF(sequence);
+  if (!ok)
+  {
+    return NULL;
+  }
+  return PyLong_FromSize_t(total);
 }
 
-static PyObject* api_rflush(PyObject *self, PyObject *args)
+static PyObject* servlet_rflush(ServletObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
 {
-  PyObject *capsule;
-  pyassert(PyArg_ParseTuple(args, "O", &capsule));
-  servlet *s = get_servlet(capsule);
+  (void)args;
+  servlet *s = get_servlet(self);
+  if (!s || !check_nargs("rflush", nargs, 0))
+  {
+    return NULL;
+  }
   rflush(s);
   Py_RETURN_NONE;
 }
 
+#define SERVLET_METHOD(name) \
+  {#name, (PyCFunction)(void(*)(void))servlet_##name, METH_FASTCALL, NULL}
+
+static PyMethodDef servlet_methods[] = {
+  SERVLET_METHOD(get_arg),
+  SERVLET_METHOD(get_method),
+  SERVLET_METHOD(get_header),
+  SERVLET_METHOD(set_status),
+  SERVLET_METHOD(set_header),
+  SERVLET_METHOD(rwrite),
+  SERVLET_METHOD(rwritelines),
+  SERVLET_METHOD(rwritev),
+  SERVLET_METHOD(rflush),
+  {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject ServletType = {
+  PyVarObject_HEAD_INIT(NULL, 0)
+  .tp_name = "modserver.Servlet",
+  .tp_basicsize = sizeof(ServletObject),
+  .tp_flags = Py_TPFLAGS_DEFAULT,
+  .tp_doc = "The request being handled.",
+  .tp_methods = servlet_methods,
+};
+
+/*
+The module functions take the servlet as their first argument, as in rwrite(s, "hello").
+They forward to the methods of the Servlet type.
+*/
+#define MODULE_FUNCTION(name) \
+  static PyObject* api_##name(PyObject *module, PyObject *const *args, Py_ssize_t nargs) \
+  { \
+    (void)module; \
+    if (nargs < 1 || !PyObject_TypeCheck(args[0], &ServletType)) \
+    { \
+      PyErr_SetString(PyExc_TypeError, #name "() expects a servlet as its first argument"); \
+      return NULL; \
+    } \
+    return servlet_##name((ServletObject*)args[0], args + 1, nargs - 1); \
+  }
+
+MODULE_FUNCTION(get_arg)
+MODULE_FUNCTION(get_method)
+MODULE_FUNCTION(get_header)
+MODULE_FUNCTION(set_status)
+MODULE_FUNCTION(set_header)
+MODULE_FUNCTION(rwrite)
+MODULE_FUNCTION(rwritelines)
+MODULE_FUNCTION(rwritev)
+MODULE_FUNCTION(rflush)
+
+#define API_FUNCTION(name) \
+  {#name, (PyCFunction)(void(*)(void))api_##name, METH_FASTCALL, "m_doc: " #name}
+
 static PyMethodDef api_methods[] = {
-  {"get_arg", api_get_arg, METH_VARARGS, "m_doc: get_arg"},
-  {"get_method", api_get_method, METH_VARARGS, "m_doc: get_method"},
-  {"get_header", api_get_header, METH_VARARGS, "m_doc: get_header"},
-  {"set_status", api_set_status, METH_VARARGS, "m_doc: set_status"},
-  {"set_header", api_set_header, METH_VARARGS, "m_doc: set_header"},
-  {"rwrite", api_rwrite, METH_VARARGS, "m_doc: rwrite"},
-  {"rflush", api_rflush, METH_VARARGS, "m_doc: rflush"},
+  API_FUNCTION(get_arg),
+  API_FUNCTION(get_method),
+  API_FUNCTION(get_header),
+  API_FUNCTION(set_status),
+  API_FUNCTION(set_header),
+  API_FUNCTION(rwrite),
+  API_FUNCTION(rwritelines),
+  API_FUNCTION(rwritev),
+  API_FUNCTION(rflush),
   {NULL, NULL, 0, NULL}
 };
 
 static PyModuleDef api_module = {
-  PyModuleDef_HEAD_INIT, 
-  "modserver", 
-  NULL, 
-  -1, 
+  PyModuleDef_HEAD_INIT,
+  "modserver",
+  NULL,
+  -1,
   api_methods,
   NULL, NULL, NULL, NULL
 };
 
 static PyObject* PyInit_api(void)
 {
-  return PyModule_Create(&api_module);
+  if (PyType_Ready(&ServletType) < 0)
+  {
+    return NULL;
+  }
+  PyObject *module = PyModule_Create(&api_module);
+  if (!module)
+  {
+    return NULL;
+  }
+  Py_INCREF(&ServletType);
+  if (PyModule_AddObject(module, "Servlet", (PyObject*)&ServletType) < 0)
+  {
+    Py_DECREF(&ServletType);
+    Py_DECREF(module);
+    return NULL;
+  }
+  return module;
+}
+
+/*
+WSGI
+https://www.python.org/dev/peps/pep-3333/
+
+A servlet that defines application(environ, start_response) instead of run(s) is served as
+a WSGI application. The adapter is written in C so each request costs one dict and no
+Python-level glue. PEP 3333 requires environ to be a real dict, so it is filled in eagerly,
+but its keys and constant values are created once per process. The input stream, the
+start_response and write callables, and the file wrapper type are reused for every request.
+*/
+
+typedef struct
+{
+  PyObject_HEAD
+  FILE *f;
+  Py_ssize_t remaining;
+} WsgiInputObject;
+
+typedef struct
+{
+  PyObject_HEAD
+  servlet *s;
+  int headers_set;
+} WsgiResponseObject;
+
+typedef struct
+{
+  PyObject_HEAD
+  PyObject *filelike;
+  Py_ssize_t block_size;
+} FileWrapperObject;
+
+static PyTypeObject WsgiInputType;
+static PyTypeObject WsgiResponseType;
+static PyTypeObject FileWrapperType;
+
+static WsgiInputObject *wsgi_input;
+static WsgiResponseObject *wsgi_response;
+static PyObject *wsgi_start_response;
+static PyObject *wsgi_write;
+static PyObject *wsgi_version;
+
+enum
+{
+  KEY_REQUEST_METHOD,
+  KEY_SCRIPT_NAME,
+  KEY_PATH_INFO,
+  KEY_QUERY_STRING,
+  KEY_CONTENT_TYPE,
+  KEY_CONTENT_LENGTH,
+  KEY_SERVER_NAME,
+  KEY_SERVER_PORT,
+  KEY_SERVER_PROTOCOL,
+  KEY_REMOTE_ADDR,
+  KEY_REMOTE_PORT,
+  KEY_WSGI_VERSION,
+  KEY_WSGI_URL_SCHEME,
+  KEY_WSGI_INPUT,
+  KEY_WSGI_ERRORS,
+  KEY_WSGI_MULTITHREAD,
+  KEY_WSGI_MULTIPROCESS,
+  KEY_WSGI_RUN_ONCE,
+  KEY_WSGI_FILE_WRAPPER,
+  NUM_KEYS
+};
+
+static const char *key_names[NUM_KEYS] = {
+  "REQUEST_METHOD",
+  "SCRIPT_NAME",
+  "PATH_INFO",
+  "QUERY_STRING",
+  "CONTENT_TYPE",
+  "CONTENT_LENGTH",
+  "SERVER_NAME",
+  "SERVER_PORT",
+  "SERVER_PROTOCOL",
+  "REMOTE_ADDR",
+  "REMOTE_PORT",
+  "wsgi.version",
+  "wsgi.url_scheme",
+  "wsgi.input",
+  "wsgi.errors",
+  "wsgi.multithread",
+  "wsgi.multiprocess",
+  "wsgi.run_once",
+  "wsgi.file_wrapper",
+};
+
+static PyObject *keys[NUM_KEYS];
+static PyObject *empty_string;
+static PyObject *http_string;
+static PyObject *https_string;
+
+/*
+Read up to size bytes of the request body, or up to the end of the line if line is set.
+The body is never read past Content-Length so a read cannot block on a keep-alive
+connection.
+*/
+static PyObject* wsgi_input_read_impl(WsgiInputObject *self, Py_ssize_t size, int line)
+{
+  if (size < 0 || size > self->remaining)
+  {
+    size = self->remaining;
+  }
+  PyObject *bytes = PyBytes_FromStringAndSize(NULL, size);
+  if (!bytes)
+  {
+    return NULL;
+  }
+  char *buffer = PyBytes_AS_STRING(bytes);
+  Py_ssize_t length = 0;
+  if (line)
+  {
+    while (length < size)
+    {
+      int c = getc(self->f);
+      if (c == EOF)
+      {
+        break;
+      }
+      buffer[length++] = c;
+      if (c == '\n')
+      {
+        break;
+      }
+    }
+  }
+  else if (size > 0)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    length = fread(buffer, 1, size, self->f);
+    Py_END_ALLOW_THREADS
+  }
+  self->remaining -= length;
+  if (length != size && _PyBytes_Resize(&bytes, length) < 0)
+  {
+    return NULL;
+  }
+  return bytes;
+}
+
+static int optional_size(const char *name, PyObject *const *args, Py_ssize_t nargs,
+  Py_ssize_t *size)
+{
+  *size = -1;
+  if (nargs > 1)
+  {
+    PyErr_Format(PyExc_TypeError, "%s() takes at most 1 argument", name);
+    return 0;
+  }
+  if (nargs == 1 && args[0] != Py_None)
+  {
+    *size = PyLong_AsSsize_t(args[0]);
+    if (*size == -1 && PyErr_Occurred())
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static PyObject* wsgi_input_read(WsgiInputObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  Py_ssize_t size;
+  if (!optional_size("read", args, nargs, &size))
+  {
+    return NULL;
+  }
+  return wsgi_input_read_impl(self, size, 0);
+}
+
+static PyObject* wsgi_input_readline(WsgiInputObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  Py_ssize_t size;
+  if (!optional_size("readline", args, nargs, &size))
+  {
+    return NULL;
+  }
+  return wsgi_input_read_impl(self, size, 1);
+}
+
+static PyObject* wsgi_input_readlines(WsgiInputObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  Py_ssize_t hint;
+  if (!optional_size("readlines", args, nargs, &hint))
+  {
+    return NULL;
+  }
+  PyObject *lines = PyList_New(0);
+  Py_ssize_t total = 0;
+  while (lines)
+  {
+    PyObject *line = wsgi_input_read_impl(self, -1, 1);
+    if (!line || PyBytes_GET_SIZE(line) == 0)
+    {
+      if (!line)
+      {
+        Py_CLEAR(lines);
+      }
+      Py_XDECREF(line);
+      break;
+    }
+    total += PyBytes_GET_SIZE(line);
+    if (PyList_Append(lines, line) < 0)
+    {
+      Py_CLEAR(lines);
+    }
+    Py_DECREF(line);
+    if (hint > 0 && total >= hint)
+    {
+      break;
+    }
+  }
+  return lines;
+}
+
+static PyObject* wsgi_input_iternext(WsgiInputObject *self)
+{
+  PyObject *line = wsgi_input_read_impl(self, -1, 1);
+  if (line && PyBytes_GET_SIZE(line) == 0)
+  {
+    // Returning NULL without an exception set stops the iteration.
+    Py_CLEAR(line);
+  }
+  return line;
+}
+
+static PyMethodDef wsgi_input_methods[] = {
+  {"read", (PyCFunction)(void(*)(void))wsgi_input_read, METH_FASTCALL, NULL},
+  {"readline", (PyCFunction)(void(*)(void))wsgi_input_readline, METH_FASTCALL, NULL},
+  {"readlines", (PyCFunction)(void(*)(void))wsgi_input_readlines, METH_FASTCALL, NULL},
+  {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject WsgiInputType = {
+  PyVarObject_HEAD_INIT(NULL, 0)
+  .tp_name = "modserver.WsgiInput",
+  .tp_basicsize = sizeof(WsgiInputObject),
+  .tp_flags = Py_TPFLAGS_DEFAULT,
+  .tp_doc = "The request body.",
+  .tp_iter = PyObject_SelfIter,
+  .tp_iternext = (iternextfunc)wsgi_input_iternext,
+  .tp_methods = wsgi_input_methods,
+};
+
+/*
+Add a response header. Unlike set_header(), a repeated header such as Set-Cookie is kept
+as a list of values instead of replacing the previous value.
+*/
+static void add_header(lua_State *l, const char *name, const char *value)
+{
+  char lower[256];
+  size_t length = strlen(name);
+  if (length >= sizeof(lower))
+  {
+    set_header((servlet*)l, name, value);
+    return;
+  }
+  for (size_t i = 0; i <= length; ++i)
+  {
+    lower[i] = tolower((unsigned char)name[i]);
+  }
+  lua_getfield(l, 1, "response_headers");
+  lua_getfield(l, -1, lower);
+  if (!lua_istable(l, -1))
+  {
+    lua_pop(l, 2);
+    set_header((servlet*)l, name, value);
+    return;
+  }
+  lua_getfield(l, -1, "value");
+  if (!lua_istable(l, -1))
+  {
+    lua_createtable(l, 2, 0);
+    lua_insert(l, -2);
+    lua_rawseti(l, -2, 1);
+    lua_pushvalue(l, -1);
+    lua_setfield(l, -3, "value");
+  }
+  lua_pushstring(l, value);
+  lua_rawseti(l, -2, lua_rawlen(l, -2) + 1);
+  lua_pop(l, 3);
+}
+
+static PyObject* wsgi_response_start_response(WsgiResponseObject *self,
+  PyObject *const *args, Py_ssize_t nargs)
+{
+  if (!self->s)
+  {
+    PyErr_SetString(PyExc_RuntimeError, "start_response() called outside of a request");
+    return NULL;
+  }
+  if (nargs < 2 || nargs > 3)
+  {
+    PyErr_SetString(PyExc_TypeError, "start_response() takes 2 or 3 arguments");
+    return NULL;
+  }
+  lua_State *l = (lua_State*)self->s;
+  lua_getfield(l, 1, "response_headers_written");
+  int headers_written = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  if (nargs == 3 && args[2] != Py_None)
+  {
+    if (headers_written)
+    {
+      // Re-raise the exception of the application.
+      PyObject *type = PyTuple_GetItem(args[2], 0);
+      PyObject *value = PyTuple_GetItem(args[2], 1);
+      PyObject *traceback = PyTuple_GetItem(args[2], 2);
+      if (type && value && traceback)
+      {
+        Py_INCREF(type);
+        Py_INCREF(value);
+        Py_INCREF(traceback);
+        PyErr_Restore(type, value, traceback);
+      }
+      return NULL;
+    }
+    // Replace the headers that were set before the error.
+    lua_newtable(l);
+    lua_setfield(l, 1, "response_headers");
+  }
+  else if (self->headers_set)
+  {
+    PyErr_SetString(PyExc_AssertionError, "start_response() called twice");
+    return NULL;
+  }
+  const char *status = PyUnicode_AsUTF8(args[0]);
+  if (!status)
+  {
+    return NULL;
+  }
+  set_status(self->s, atoi(status));
+  PyObject *headers = PySequence_Fast(args[1], "the response headers must be a list");
+  if (!headers)
+  {
+    return NULL;
+  }
+  Py_ssize_t num_headers = PySequence_Fast_GET_SIZE(headers);
+  for (Py_ssize_t i = 0; i < num_headers; ++i)
+  {
+    const char *name;
+    const char *value;
+    PyObject *header = PySequence_Fast_GET_ITEM(headers, i);
+    if (!PyTuple_Check(header) || !PyArg_ParseTuple(header, "ss", &name, &value))
+    {
+      if (!PyErr_Occurred())
+      {
+        PyErr_SetString(PyExc_TypeError, "each header must be a (name, value) tuple");
+      }
+      Py_DECREF(headers);
+      return NULL;
+    }
+    add_header(l, name, value);
+  }
+  Py_DECREF(headers);
+  self->headers_set = 1;
+  Py_INCREF(wsgi_write);
+  return wsgi_write;
+}
+
+/*
+The write() callable returned by start_response() for applications that predate iterable
+bodies.
+*/
+static PyObject* wsgi_response_write(WsgiResponseObject *self, PyObject *const *args,
+  Py_ssize_t nargs)
+{
+  if (!self->headers_set)
+  {
+    PyErr_SetString(PyExc_AssertionError, "write() called before start_response()");
+    return NULL;
+  }
+  servlet_object->s = self->s;
+  return servlet_rwrite(servlet_object, args, nargs);
+}
+
+static PyMethodDef wsgi_response_methods[] = {
+  {"start_response", (PyCFunction)(void(*)(void))wsgi_response_start_response,
+    METH_FASTCALL, NULL},
+  {"write", (PyCFunction)(void(*)(void))wsgi_response_write, METH_FASTCALL, NULL},
+  {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject WsgiResponseType = {
+  PyVarObject_HEAD_INIT(NULL, 0)
+  .tp_name = "modserver.WsgiResponse",
+  .tp_basicsize = sizeof(WsgiResponseObject),
+  .tp_flags = Py_TPFLAGS_DEFAULT,
+  .tp_methods = wsgi_response_methods,
+};
+
+static PyObject* file_wrapper_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+  static char *keywords[] = {"filelike", "block_size", NULL};
+  PyObject *filelike;
+  Py_ssize_t block_size = 8192;
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|n", keywords, &filelike, &block_size))
+  {
+    return NULL;
+  }
+  FileWrapperObject *self = (FileWrapperObject*)type->tp_alloc(type, 0);
+  if (self)
+  {
+    Py_INCREF(filelike);
+    self->filelike = filelike;
+    self->block_size = block_size > 0 ? block_size : 8192;
+  }
+  return (PyObject*)self;
+}
+
+static void file_wrapper_dealloc(FileWrapperObject *self)
+{
+  Py_XDECREF(self->filelike);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject* file_wrapper_iternext(FileWrapperObject *self)
+{
+  PyObject *data = PyObject_CallMethod(self->filelike, "read", "n", self->block_size);
+  if (data && PyObject_Length(data) == 0)
+  {
+    Py_CLEAR(data);
+  }
+  return data;
+}
+
+static PyObject* file_wrapper_close(FileWrapperObject *self, PyObject *unused)
+{
+  (void)unused;
+  if (PyObject_HasAttrString(self->filelike, "close"))
+  {
+    return PyObject_CallMethod(self->filelike, "close", NULL);
+  }
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef file_wrapper_methods[] = {
+  {"close", (PyCFunction)file_wrapper_close, METH_NOARGS, NULL},
+  {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject FileWrapperType = {
+  PyVarObject_HEAD_INIT(NULL, 0)
+  .tp_name = "modserver.FileWrapper",
+  .tp_basicsize = sizeof(FileWrapperObject),
+  .tp_flags = Py_TPFLAGS_DEFAULT,
+  .tp_doc = "wsgi.file_wrapper: a file sent with sendfile() when possible.",
+  .tp_new = file_wrapper_new,
+  .tp_dealloc = (destructor)file_wrapper_dealloc,
+  .tp_iter = PyObject_SelfIter,
+  .tp_iternext = (iternextfunc)file_wrapper_iternext,
+  .tp_methods = file_wrapper_methods,
+};
+
+static FILE* state_file(lua_State *l, const char *field)
+{
+  lua_getfield(l, 1, field);
+  luaL_Stream *stream = luaL_testudata(l, -1, LUA_FILEHANDLE);
+  lua_pop(l, 1);
+  return stream ? stream->f : NULL;
+}
+
+static void set_item(PyObject *environ, PyObject *key, PyObject *value)
+{
+  if (value)
+  {
+    PyDict_SetItem(environ, key, value);
+    Py_DECREF(value);
+  }
+}
+
+/*
+Set an environ item from a field of the table on the top of the Lua stack.
+*/
+static void set_field_item(lua_State *l, PyObject *environ, PyObject *key,
+  const char *field)
+{
+  lua_getfield(l, -1, field);
+  size_t length;
+  const char *value = lua_tolstring(l, -1, &length);
+  if (value)
+  {
+    set_item(environ, key, PyUnicode_DecodeLatin1(value, length, NULL));
+  }
+  lua_pop(l, 1);
+}
+
+static PyObject* build_environ(lua_State *l)
+{
+  PyObject *environ = PyDict_New();
+  if (!environ)
+  {
+    return NULL;
+  }
+  lua_getfield(l, 1, "request");
+  set_field_item(l, environ, keys[KEY_REQUEST_METHOD], "method");
+  set_field_item(l, environ, keys[KEY_PATH_INFO], "uri_path");
+  set_field_item(l, environ, keys[KEY_SERVER_PROTOCOL], "version");
+  lua_getfield(l, -1, "uri");
+  const char *uri = lua_tostring(l, -1);
+  const char *query = uri ? strchr(uri, '?') : NULL;
+  set_item(environ, keys[KEY_QUERY_STRING],
+    PyUnicode_DecodeLatin1(query ? query + 1 : "", query ? strlen(query + 1) : 0, NULL));
+  lua_pop(l, 1);
+  const char *host = NULL;
+  lua_getfield(l, -1, "headers");
+  lua_pushnil(l);
+  while (lua_next(l, -2))
+  {
+    size_t name_length;
+    size_t value_length;
+    const char *name = lua_tolstring(l, -2, &name_length);
+    const char *value = lua_tolstring(l, -1, &value_length);
+    if (name && value)
+    {
+      PyObject *value_obj = PyUnicode_DecodeLatin1(value, value_length, NULL);
+      if (strcmp(name, "content-type") == 0)
+      {
+        set_item(environ, keys[KEY_CONTENT_TYPE], value_obj);
+      }
+      else if (strcmp(name, "content-length") == 0)
+      {
+        set_item(environ, keys[KEY_CONTENT_LENGTH], value_obj);
+        wsgi_input->remaining = strtol(value, NULL, 10);
+      }
+      else
+      {
+        if (strcmp(name, "host") == 0)
+        {
+          host = value;
+        }
+        char key[256] = "HTTP_";
+        size_t i;
+        for (i = 0; i < name_length && i + 6 < sizeof(key); ++i)
+        {
+          key[i + 5] = name[i] == '-' ? '_' : toupper((unsigned char)name[i]);
+        }
+        key[i + 5] = '\0';
+        PyObject *key_obj = PyUnicode_FromString(key);
+        if (key_obj)
+        {
+          set_item(environ, key_obj, value_obj);
+          Py_DECREF(key_obj);
+        }
+        else
+        {
+          Py_XDECREF(value_obj);
+        }
+      }
+    }
+    lua_pop(l, 1);
+  }
+  // The headers table keeps the host string alive until it is popped below.
+  const char *host_end = host ? strchr(host, ':') : NULL;
+  if (host)
+  {
+    size_t host_length = host_end ? (size_t)(host_end - host) : strlen(host);
+    set_item(environ, keys[KEY_SERVER_NAME], PyUnicode_DecodeLatin1(host, host_length, NULL));
+  }
+  lua_pop(l, 2);
+  lua_getfield(l, 1, "listen_address");
+  const char *listen_address = lua_tostring(l, -1);
+  const char *port = listen_address ? strrchr(listen_address, ':') : NULL;
+  set_item(environ, keys[KEY_SERVER_PORT], PyUnicode_FromString(port ? port + 1 : ""));
+  if (!host && listen_address)
+  {
+    set_item(environ, keys[KEY_SERVER_NAME],
+      PyUnicode_DecodeLatin1(listen_address, port - listen_address, NULL));
+  }
+  lua_pop(l, 1);
+  lua_getfield(l, 1, "client_address");
+  if (lua_istable(l, -1))
+  {
+    set_field_item(l, environ, keys[KEY_REMOTE_ADDR], "addr");
+    lua_getfield(l, -1, "port");
+    if (lua_isnumber(l, -1))
+    {
+      set_item(environ, keys[KEY_REMOTE_PORT],
+        PyUnicode_FromFormat("%d", (int)lua_tointeger(l, -1)));
+    }
+    lua_pop(l, 1);
+  }
+  lua_pop(l, 1);
+  PyDict_SetItem(environ, keys[KEY_SCRIPT_NAME], empty_string);
+  PyDict_SetItem(environ, keys[KEY_WSGI_VERSION], wsgi_version);
+  lua_getfield(l, 1, "tls");
+  PyDict_SetItem(environ, keys[KEY_WSGI_URL_SCHEME], 
+    lua_isnil(l, -1) ? http_string : https_string);
+  lua_pop(l, 1);
+  PyDict_SetItem(environ, keys[KEY_WSGI_INPUT], (PyObject*)wsgi_input);
+  PyObject *errors = PySys_GetObject("stderr");
+  if (errors)
+  {
+    PyDict_SetItem(environ, keys[KEY_WSGI_ERRORS], errors);
+  }
+  PyDict_SetItem(environ, keys[KEY_WSGI_MULTITHREAD], Py_False);
+  PyDict_SetItem(environ, keys[KEY_WSGI_MULTIPROCESS], Py_True);
+  PyDict_SetItem(environ, keys[KEY_WSGI_RUN_ONCE], Py_False);
+  PyDict_SetItem(environ, keys[KEY_WSGI_FILE_WRAPPER], (PyObject*)&FileWrapperType);
+  if (PyErr_Occurred())
+  {
+    Py_DECREF(environ);
+    return NULL;
+  }
+  return environ;
+}
+
+/*
+Write the status line and headers if the application has not written any of the body.
+*/
+static int write_headers(lua_State *l)
+{
+  lua_getfield(l, 1, "response_headers_written");
+  int headers_written = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  if (headers_written)
+  {
+    return 1;
+  }
+  lua_getfield(l, 1, "write_status_line_and_headers");
+  lua_pushvalue(l, 1);
+  if (lua_pcall(l, 1, 0, 0) != LUA_OK)
+  {
+    fprintf(stderr, "%s\n", lua_tostring(l, -1));
+    lua_pop(l, 1);
+    return 0;
+  }
+  return 1;
+}
+
+static int has_response_header(lua_State *l, const char *name)
+{
+  lua_getfield(l, 1, "response_headers");
+  lua_getfield(l, -1, name);
+  int has_header = !lua_isnil(l, -1);
+  lua_pop(l, 2);
+  return has_header;
+}
+
+/*
+Send a file returned through wsgi.file_wrapper with sendfile() so its contents never pass
+through Python or user space. Return 0 if the file or the response has no descriptor, as 
+for TLS in user space, and the file must be read instead.
+*/
+static int send_file_wrapper(lua_State *l, FileWrapperObject *wrapper)
+{
+#ifdef __linux__
+  FILE *out = state_file(l, "clientfd_write");
+  if (!out || fileno(out) < 0)
+  {
+    return 0;
+  }
+  PyObject *fd_obj = PyObject_CallMethod(wrapper->filelike, "fileno", NULL);
+  if (!fd_obj)
+  {
+    PyErr_Clear();
+    return 0;
+  }
+  int in_fd = PyLong_AsLong(fd_obj);
+  Py_DECREF(fd_obj);
+  struct stat st;
+  if (in_fd < 0 || fstat(in_fd, &st) != 0 || !S_ISREG(st.st_mode))
+  {
+    PyErr_Clear();
+    return 0;
+  }
+  // Python file objects buffer reads, so start at the position Python reports.
+  off_t offset = 0;
+  PyObject *position = PyObject_CallMethod(wrapper->filelike, "tell", NULL);
+  if (position)
+  {
+    offset = PyLong_AsLongLong(position);
+    Py_DECREF(position);
+  }
+  PyErr_Clear();
+  off_t remaining = st.st_size > offset ? st.st_size - offset : 0;
+  lua_getfield(l, 1, "request");
+  lua_getfield(l, -1, "method");
+  int head = strcmp(luaL_optstring(l, -1, ""), "HEAD") == 0;
+  lua_pop(l, 2);
+  int chunked = !has_response_header(l, "content-length");
+  if (!write_headers(l))
+  {
+    return 1;
+  }
+  if (head || remaining == 0)
+  {
+    return 1;
+  }
+  if (chunked)
+  {
+    fprintf(out, "%llX\r\n", (unsigned long long)remaining);
+  }
+  fflush(out);
+  int out_fd = fileno(out);
+  while (remaining > 0)
+  {
+    ssize_t sent;
+    Py_BEGIN_ALLOW_THREADS
+    sent = sendfile(out_fd, in_fd, &offset, remaining);
+    Py_END_ALLOW_THREADS
+    if (sent <= 0)
+    {
+      if (sent < 0 && errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    remaining -= sent;
+  }
+  if (chunked)
+  {
+    fputs("\r\n", out);
+  }
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+static int wsgi_run(lua_State *l)
+{
+  PyObject **application = luaL_checkudata(l, lua_upvalueindex(1), PYTHON_SERVLET);
+  wsgi_input->f = state_file(l, "clientfd_read");
+  wsgi_input->remaining = 0;
+  wsgi_response->s = (servlet*)l;
+  wsgi_response->headers_set = 0;
+  servlet_object->s = (servlet*)l;
+  PyObject *result = NULL;
+  PyObject *environ = build_environ(l);
+  if (environ)
+  {
+    PyObject *args[] = {environ, wsgi_start_response};
+    result = PyObject_Vectorcall(*application, args, 2, NULL);
+    Py_DECREF(environ);
+  }
+  if (result)
+  {
+    if (Py_TYPE(result) == &FileWrapperType && wsgi_response->headers_set &&
+      send_file_wrapper(l, (FileWrapperObject*)result))
+    {
+      // The file was sent.
+    }
+    else
+    {
+      PyObject *iterator = PyObject_GetIter(result);
+      PyObject *item;
+      while (iterator && (item = PyIter_Next(iterator)))
+      {
+        PyObject *ret = NULL;
+        if (!wsgi_response->headers_set)
+        {
+          PyErr_SetString(PyExc_AssertionError, "start_response() was not called");
+        }
+        else
+        {
+          ret = servlet_rwrite(servlet_object, &item, 1);
+        }
+        Py_DECREF(item);
+        if (!ret)
+        {
+          break;
+        }
+        Py_DECREF(ret);
+      }
+      Py_XDECREF(iterator);
+    }
+    if (PyObject_HasAttrString(result, "close"))
+    {
+      PyObject *ret = PyObject_CallMethod(result, "close", NULL);
+      Py_XDECREF(ret);
+    }
+    Py_DECREF(result);
+  }
+  if (PyErr_Occurred())
+  {
+    PyErr_Print();
+    lua_getfield(l, 1, "response_headers_written");
+    int headers_written = lua_toboolean(l, -1);
+    lua_pop(l, 1);
+    if (!headers_written)
+    {
+      lua_newtable(l);
+      lua_setfield(l, 1, "response_headers");
+      set_status((servlet*)l, 500);
+      const char message[] = "500 Internal Server Error";
+      rwrite((servlet*)l, message, sizeof(message) - 1);
+    }
+  }
+  else if (wsgi_response->headers_set && !has_response_header(l, "content-length"))
+  {
+    /*
+    An empty body still sends the status the application chose rather than the 204 the
+    server sends for a servlet that writes nothing.
+    */
+    lua_getfield(l, 1, "response_headers_written");
+    int headers_written = lua_toboolean(l, -1);
+    lua_pop(l, 1);
+    if (!headers_written)
+    {
+      set_header((servlet*)l, "Content-Length", "0");
+      write_headers(l);
+    }
+  }
+  wsgi_response->s = NULL;
+  servlet_object->s = NULL;
+  wsgi_input->f = NULL;
+  return 0;
+}
+
+/*
+Create the objects that are reused by every WSGI request.
+*/
+static int wsgi_init(void)
+{
+  if (PyType_Ready(&WsgiInputType) < 0 || PyType_Ready(&WsgiResponseType) < 0 ||
+    PyType_Ready(&FileWrapperType) < 0)
+  {
+    return 0;
+  }
+  for (int i = 0; i < NUM_KEYS; ++i)
+  {
+    keys[i] = PyUnicode_InternFromString(key_names[i]);
+    if (!keys[i])
+    {
+      return 0;
+    }
+  }
+  empty_string = PyUnicode_InternFromString("");
+  http_string = PyUnicode_InternFromString("http");
+  https_string = PyUnicode_InternFromString("https");
+  wsgi_version = Py_BuildValue("(ii)", 1, 0);
+  wsgi_input = PyObject_New(WsgiInputObject, &WsgiInputType);
+  wsgi_response = PyObject_New(WsgiResponseObject, &WsgiResponseType);
+  if (!empty_string || !http_string || !https_string || !wsgi_version || !wsgi_input 
+    || !wsgi_response)
+  {
+    return 0;
+  }
+  wsgi_input->f = NULL;
+  wsgi_input->remaining = 0;
+  wsgi_response->s = NULL;
+  wsgi_response->headers_set = 0;
+  wsgi_start_response = PyObject_GetAttrString((PyObject*)wsgi_response, "start_response");
+  wsgi_write = PyObject_GetAttrString((PyObject*)wsgi_response, "write");
+  return wsgi_start_response && wsgi_write;
 }
 
 static int mod_init(lua_State *l)
 {
   PyImport_AppendInittab("modserver", PyInit_api);
   Py_Initialize();
+  PyObject *api = PyImport_ImportModule("modserver");
+  if (!api)
+  {
+    PyErr_Print();
+    return luaL_error(l, "unable to initialize the modserver Python module");
+  }
+  Py_DECREF(api);
+  servlet_object = PyObject_New(ServletObject, &ServletType);
+  assert(servlet_object);
+  servlet_object->s = NULL;
+  run_args = PyTuple_Pack(1, (PyObject*)servlet_object);
+  assert(run_args);
+  if (!wsgi_init())
+  {
+    PyErr_Print();
+    return luaL_error(l, "unable to initialize WSGI");
+  }
+  /*
+  importlib's SourceFileLoader compiles servlets and reads and writes the same __pycache__
+  bytecode files that import does, so an unmodified servlet is not compiled again.
+  */
+  PyObject *machinery = PyImport_ImportModule("importlib.machinery");
+  if (machinery)
+  {
+    source_file_loader = PyObject_GetAttrString(machinery, "SourceFileLoader");
+    Py_DECREF(machinery);
+  }
+  if (!source_file_loader)
+  {
+    PyErr_Print();
+    return luaL_error(l, "importlib.machinery.SourceFileLoader is not available");
+  }
   return 0;
 }
 
 static int servlet_run(lua_State *l)
 {
-  PyObject *run = lua_touserdata(l, lua_upvalueindex(1));
-  assert(PyCallable_Check(run));
-  PyObject *capsule = PyCapsule_New(l, "servlet*", NULL);
-  assert(capsule);
-  assert(PyCapsule_GetPointer(capsule, "servlet*"));
-  PyObject * ret = PyObject_CallFunction(run, "(O)", capsule);
+  PyObject **run = luaL_checkudata(l, lua_upvalueindex(1), PYTHON_SERVLET);
+  servlet_object->s = (servlet*)l;
+  PyObject *ret = PyObject_Call(*run, run_args, NULL);
+  servlet_object->s = NULL;
   if (!ret)
   {
     PyErr_Print();
   }
+  Py_XDECREF(ret);
+  return 0;
+}
+
+static int python_servlet_gc(lua_State *l)
+{
+  PyObject **run = luaL_checkudata(l, 1, PYTHON_SERVLET);
+  Py_CLEAR(*run);
   return 0;
 }
 
+/*
+Compile the servlet, or load its cached bytecode, and return the code object.
+*/
+static PyObject* get_code(const char *path)
+{
+  PyObject *loader = PyObject_CallFunction(source_file_loader, "ss", "__main__", path);
+  if (!loader)
+  {
+    return NULL;
+  }
+  PyObject *code = PyObject_CallMethod(loader, "get_code", "s", "__main__");
+  Py_DECREF(loader);
+  return code;
+}
+
 static int mod_load_servlet(lua_State *l)
 {
   const char *path = luaL_checkstring(l, -1);
-  FILE *f = fopen(path, "r");
-  if (!f)
+  PyObject *code = get_code(path);
+  if (!code)
   {
-    return luaL_error(l, "servlet not found: %s", path);
+    PyErr_Print();
+    return luaL_error(l, "unable to load servlet: %s", path);
   }
   PyObject* main_module = PyImport_AddModule("__main__");
   assert(main_module);
   PyObject* main_dict = PyModule_GetDict(main_module);
+  assert(main_dict);
   // run each program in a different environment
   // PyDict_Copy appears to be cheap in terms of memory
-  PyObject* main_dict_copy = PyDict_Copy(main_dict);
-  assert(main_dict);
-  (void)PyRun_File(f, path, Py_file_input, main_dict_copy, main_dict_copy);
-  fclose(f);
-  PyObject *run = PyDict_GetItemString(main_dict_copy, "run");
-  if (!run)
+  PyObject* globals = PyDict_Copy(main_dict);
+  assert(globals);
+  PyObject *file = PyUnicode_FromString(path);
+  PyDict_SetItemString(globals, "__file__", file);
+  Py_XDECREF(file);
+  PyObject *result = PyEval_EvalCode(code, globals, globals);
+  Py_DECREF(code);
+  if (!result)
   {
     PyErr_Print();
-    return 0;
+    Py_DECREF(globals);
+    return luaL_error(l, "unable to load servlet: %s", path);
   }
-  if (PyCallable_Check(run))
+  Py_DECREF(result);
+  lua_CFunction run_function = servlet_run;
+  PyObject *run = PyDict_GetItemString(globals, "run");
+  if (!run)
   {
-    lua_newtable(l);
-    lua_pushlightuserdata(l, run);
-    lua_pushcclosure(l, servlet_run, 1);
-    lua_setfield(l, -2, "run");
-    return 1;
+    // Serve a WSGI application when the servlet does not define run().
+    run = PyDict_GetItemString(globals, "application");
+    run_function = wsgi_run;
   }
-  return 0;
+  if (!run || !PyCallable_Check(run))
+  {
+    Py_DECREF(globals);
+    return luaL_error(l, "the servlet does not define run() or application(): %s", path);
+  }
+  lua_newtable(l);
+  PyObject **ud = lua_newuserdata(l, sizeof(PyObject*));
+  Py_INCREF(run);
+  *ud = run;
+  // The function keeps the globals of the servlet alive.
+  Py_DECREF(globals);
+  luaL_setmetatable(l, PYTHON_SERVLET);
+  lua_pushcclosure(l, run_function, 1);
+  lua_setfield(l, -2, "run");
+  return 1;
 }
 
 static int mod_cleanup(lua_State *l)
 {
+  (void)l;
   Py_Finalize();
   return 0;
 }
 
-static const luaL_Reg module_python[] = 
+static const luaL_Reg module_python[] =
 {
   {"init", mod_init},
   {"load_servlet", mod_load_servlet},
@@ -206,11 +1432,18 @@ static const luaL_Reg module_python[] =
 
 LUALIB_API int luaopen_module_python(lua_State *l)
 {
+  luaL_newmetatable(l, PYTHON_SERVLET);
+  lua_pushcfunction(l, python_servlet_gc);
+  lua_setfield(l, -2, "__gc");
+  lua_pop(l, 1);
   luaL_newlib(l, module_python);
   return 1;
 }
 
 // https://docs.python.org/3/extending/embedding.html
+// https://www.python.org/dev/peps/pep-3333/
+// https://docs.python.org/3/c-api/structures.html#c.METH_FASTCALL
+// https://docs.python.org/3/library/importlib.html#importlib.machinery.SourceFileLoader
 // http://stackoverflow.com/questions/36098584/embedded-python-does-not-find-some-modules-ctypes
 // http://bugs.python.org/issue26598
 // https://github.com/markpasc/luabject/blob/master/src/luabject.cpp
@@ -1,5 +1,6 @@
 // C99
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -7,79 +8,731 @@
 #include <lauxlib.h>
 #include <lua.h>
 #include <lualib.h>
+#include "luacompat.h"
 // Ruby
 #include <ruby.h>
 // Local
 #include "modserver.h"
 
-static VALUE api_get_arg(VALUE self, VALUE s_, VALUE name_)
+#define RUBY_SERVLET "module.ruby.servlet"
+
+/*
+Servlets receive a Modserver::Servlet object that wraps the servlet pointer. One object is
+created per process and reused for every request. The pointer is set before the servlet is
+called and cleared afterward so an object kept past the end of a request raises an
+exception instead of crashing.
+*/
+typedef struct
+{
+  servlet *s;
+} servlet_data;
+
+static const rb_data_type_t servlet_type = {
+  .wrap_struct_name = "modserver_servlet",
+  .function = {
+    .dfree = RUBY_DEFAULT_FREE,
+  },
+  .flags = RUBY_TYPED_FREE_IMMEDIATELY,
+};
+
+/*
+rack.input reads the request body from the client stream without reading past
+Content-Length.
+*/
+typedef struct
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  const void *name = StringValueCStr(name_);
-  const char *arg = get_arg(s, name);
-  if (arg)
+  FILE *f;
+  long remaining;
+} input_data;
+
+static const rb_data_type_t input_type = {
+  .wrap_struct_name = "modserver_input",
+  .function = {
+    .dfree = RUBY_DEFAULT_FREE,
+  },
+  .flags = RUBY_TYPED_FREE_IMMEDIATELY,
+};
+
+// Method IDs are looked up once.
+static ID id_call;
+static ID id_run;
+static ID id_module_eval;
+static ID id_extend;
+static ID id_each;
+static ID id_close;
+static ID id_to_app;
+static ID id_message;
+static ID id_backtrace;
+static ID id_join;
+
+static VALUE servlet_object;
+static VALUE input_object;
+// Every loaded servlet is kept here so the garbage collector does not free it.
+static VALUE loaded_servlets;
+static VALUE rack_builder;
+static VALUE rack_version;
+
+static servlet* get_servlet(VALUE s_)
+{
+  servlet_data *data = rb_check_typeddata(s_, &servlet_type);
+  if (!data->s)
   {
-    return rb_str_new_cstr(arg);
+    rb_raise(rb_eRuntimeError, "the servlet is used outside of a request");
   }
-  return Qnil;
+  return data->s;
 }
 
-static VALUE api_get_method(VALUE self, VALUE s_)
+static VALUE str_or_nil(const char *str)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  const char *method = get_method(s);
-  if (method)
+  if (str)
   {
-    return rb_str_new_cstr(method);
+    return rb_str_new_cstr(str);
   }
   return Qnil;
 }
 
-static VALUE api_get_header(VALUE self, VALUE s_, VALUE key_)
+static VALUE servlet_get_arg(VALUE self, VALUE name_)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  const void *key = StringValueCStr(key_);
-  const char *value = get_header(s, key);
-  if (value)
+  servlet *s = get_servlet(self);
+  return str_or_nil(get_arg(s, StringValueCStr(name_)));
+}
+
+static VALUE servlet_get_method(VALUE self)
+{
+  servlet *s = get_servlet(self);
+  return str_or_nil(get_method(s));
+}
+
+static VALUE servlet_get_header(VALUE self, VALUE key_)
+{
+  servlet *s = get_servlet(self);
+  return str_or_nil(get_header(s, StringValueCStr(key_)));
+}
+
+static VALUE servlet_set_status(VALUE self, VALUE status_)
+{
+  servlet *s = get_servlet(self);
+  set_status(s, NUM2INT(status_));
+  return Qnil;
+}
+
+static VALUE servlet_set_header(VALUE self, VALUE key_, VALUE value_)
+{
+  servlet *s = get_servlet(self);
+  set_header(s, StringValueCStr(key_), StringValueCStr(value_));
+  return Qnil;
+}
+
+static VALUE servlet_rwrite(VALUE self, VALUE buffer)
+{
+  servlet *s = get_servlet(self);
+  StringValue(buffer);
+  size_t ret = 0;
+  if (RSTRING_LEN(buffer) > 0)
+  {
+    ret = rwrite(s, RSTRING_PTR(buffer), RSTRING_LEN(buffer));
+  }
+  return SIZET2NUM(ret);
+}
+
+// The number of strings rwritev passes to the server in one call.
+#define RWRITEV_BATCH_SIZE 64
+
+/*
+Write an array of strings, such as template fragments, as one buffer. Each batch of strings 
+is passed to the server with one rwritev() call without being copied.
+*/
+static VALUE servlet_rwritev(VALUE self, VALUE buffers)
+{
+  servlet *s = get_servlet(self);
+  Check_Type(buffers, T_ARRAY);
+  // The strings are kept on the stack, where the garbage collector finds them.
+  volatile VALUE strings[RWRITEV_BATCH_SIZE];
+  struct iovec iov[RWRITEV_BATCH_SIZE];
+  size_t total = 0;
+  long i = 0;
+  while (i < RARRAY_LEN(buffers))
   {
-    return rb_str_new_cstr(value);
+    int count = 0;
+    for (; count < RWRITEV_BATCH_SIZE && i < RARRAY_LEN(buffers); ++i)
+    {
+      VALUE buffer = rb_ary_entry(buffers, i);
+      StringValue(buffer);
+      strings[count] = buffer;
+      iov[count].iov_base = RSTRING_PTR(buffer);
+      iov[count].iov_len = RSTRING_LEN(buffer);
+      ++count;
+    }
+    total += rwritev(s, iov, count);
   }
+  return SIZET2NUM(total);
+}
+
+static VALUE servlet_rflush(VALUE self)
+{
+  servlet *s = get_servlet(self);
+  rflush(s);
   return Qnil;
 }
 
+/*
+The global functions take the servlet as their first argument, as in rwrite(s, "hello").
+*/
+static VALUE api_get_arg(VALUE self, VALUE s_, VALUE name_)
+{
+  return servlet_get_arg(s_, name_);
+}
+
+static VALUE api_get_method(VALUE self, VALUE s_)
+{
+  return servlet_get_method(s_);
+}
+
+static VALUE api_get_header(VALUE self, VALUE s_, VALUE key_)
+{
+  return servlet_get_header(s_, key_);
+}
+
 static VALUE api_set_status(VALUE self, VALUE s_, VALUE status_)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  int status = NUM2INT(status_);
-  set_status(s, status);
-  return Qnil;
+  return servlet_set_status(s_, status_);
 }
 
 static VALUE api_set_header(VALUE self, VALUE s_, VALUE key_, VALUE value_)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  const void *key = StringValueCStr(key_);
-  const void *value = StringValueCStr(value_);
-  set_header(s, key, value);
-  return Qnil;
+  return servlet_set_header(s_, key_, value_);
 }
 
 static VALUE api_rwrite(VALUE self, VALUE s_, VALUE buffer)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  const void *ptr = StringValuePtr(buffer);
-  int length = RSTRING_LEN(buffer);
-  size_t ret = rwrite(s, ptr, length);
-  return ULL2NUM(ret);
+  return servlet_rwrite(s_, buffer);
+}
+
+static VALUE api_rwritev(VALUE self, VALUE s_, VALUE buffers)
+{
+  return servlet_rwritev(s_, buffers);
 }
 
 static VALUE api_rflush(VALUE self, VALUE s_)
 {
-  servlet *s = (servlet*)NUM2ULL(s_);
-  rflush(s);
+  return servlet_rflush(s_);
+}
+
+/*
+Read up to length bytes of the request body, or up to the end of the line if line is set.
+Return nil at the end of the body.
+*/
+static VALUE input_read_impl(VALUE self, long length, int line)
+{
+  input_data *data = rb_check_typeddata(self, &input_type);
+  if (length < 0 || length > data->remaining)
+  {
+    length = data->remaining;
+  }
+  if (length == 0 || !data->f)
+  {
+    return Qnil;
+  }
+  VALUE str = rb_str_buf_new(length);
+  char *buffer = RSTRING_PTR(str);
+  long read = 0;
+  if (line)
+  {
+    while (read < length)
+    {
+      int c = getc(data->f);
+      if (c == EOF)
+      {
+        break;
+      }
+      buffer[read++] = c;
+      if (c == '\n')
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    read = fread(buffer, 1, length, data->f);
+  }
+  data->remaining -= read;
+  rb_str_set_len(str, read);
+  return read > 0 ? str : Qnil;
+}
+
+static VALUE input_read(int argc, VALUE *argv, VALUE self)
+{
+  VALUE length_, buffer;
+  rb_scan_args(argc, argv, "02", &length_, &buffer);
+  VALUE str = input_read_impl(self, NIL_P(length_) ? -1 : NUM2LONG(length_), 0);
+  if (NIL_P(str))
+  {
+    // read() without a length returns "" at the end of the body, not nil.
+    str = NIL_P(length_) ? rb_str_new(NULL, 0) : Qnil;
+  }
+  if (!NIL_P(buffer))
+  {
+    rb_str_replace(buffer, NIL_P(str) ? rb_str_new(NULL, 0) : str);
+    return NIL_P(str) ? Qnil : buffer;
+  }
+  return str;
+}
+
+static VALUE input_gets(VALUE self)
+{
+  return input_read_impl(self, -1, 1);
+}
+
+static VALUE input_each(VALUE self)
+{
+  VALUE line;
+  while (!NIL_P(line = input_read_impl(self, -1, 1)))
+  {
+    rb_yield(line);
+  }
+  return self;
+}
+
+static VALUE input_rewind(VALUE self)
+{
+  // The body is streamed from the user and cannot be read again.
+  return INT2FIX(0);
+}
+
+static VALUE input_close(VALUE self)
+{
   return Qnil;
 }
 
+static VALUE format_exception(VALUE exception)
+{
+  VALUE message = rb_funcall(exception, id_message, 0);
+  fprintf(stderr, "%s: %s\n", rb_obj_classname(exception), StringValueCStr(message));
+  VALUE backtrace = rb_funcall(exception, id_backtrace, 0);
+  if (!NIL_P(backtrace))
+  {
+    VALUE lines = rb_funcall(backtrace, id_join, 1, rb_str_new_cstr("\n\t"));
+    fprintf(stderr, "\t%s\n", StringValueCStr(lines));
+  }
+  return Qnil;
+}
+
+/*
+Print the pending exception and its backtrace, then clear it.
+*/
+static void print_exception(void)
+{
+  VALUE exception = rb_errinfo();
+  rb_set_errinfo(Qnil);
+  if (!NIL_P(exception))
+  {
+    int state;
+    rb_protect(format_exception, exception, &state);
+    rb_set_errinfo(Qnil);
+  }
+}
+
+static int headers_written(lua_State *l)
+{
+  lua_getfield(l, 1, "response_headers_written");
+  int written = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  return written;
+}
+
+static int has_response_header(lua_State *l, const char *name)
+{
+  lua_getfield(l, 1, "response_headers");
+  lua_getfield(l, -1, name);
+  int has_header = !lua_isnil(l, -1);
+  lua_pop(l, 2);
+  return has_header;
+}
+
+/*
+Answer with 500 Internal Server Error if the servlet raised an exception before it wrote
+anything.
+*/
+static void internal_server_error(lua_State *l)
+{
+  if (!headers_written(l))
+  {
+    lua_newtable(l);
+    lua_setfield(l, 1, "response_headers");
+    set_status((servlet*)l, 500);
+    const char message[] = "500 Internal Server Error";
+    rwrite((servlet*)l, message, sizeof(message) - 1);
+  }
+}
+
+static VALUE call_run(VALUE servlet)
+{
+  return rb_funcall(servlet, id_run, 1, servlet_object);
+}
+
+/*
+Call run(s) of the servlet. Exceptions are caught with rb_protect() so a servlet error
+fails the request instead of the process.
+*/
+static int servlet_run(lua_State *l)
+{
+  VALUE *servlet = luaL_checkudata(l, lua_upvalueindex(1), RUBY_SERVLET);
+  servlet_data *data = DATA_PTR(servlet_object);
+  data->s = (struct servlet*)l;
+  int state;
+  rb_protect(call_run, *servlet, &state);
+  data->s = NULL;
+  if (state)
+  {
+    print_exception();
+    internal_server_error(l);
+  }
+  return 0;
+}
+
+/*
+Rack
+https://github.com/rack/rack/blob/main/SPEC.rdoc
+
+A servlet with the .ru extension is a rackup file. run(app) sets the application and
+use(middleware) wraps it, as with Rack::Builder. The env hash is built and the response is
+written in C. Its keys and constant values are created once per process.
+*/
+enum
+{
+  KEY_REQUEST_METHOD,
+  KEY_SCRIPT_NAME,
+  KEY_PATH_INFO,
+  KEY_QUERY_STRING,
+  KEY_CONTENT_TYPE,
+  KEY_CONTENT_LENGTH,
+  KEY_SERVER_NAME,
+  KEY_SERVER_PORT,
+  KEY_SERVER_PROTOCOL,
+  KEY_REMOTE_ADDR,
+  KEY_RACK_VERSION,
+  KEY_RACK_URL_SCHEME,
+  KEY_RACK_INPUT,
+  KEY_RACK_ERRORS,
+  KEY_RACK_MULTITHREAD,
+  KEY_RACK_MULTIPROCESS,
+  KEY_RACK_RUN_ONCE,
+  KEY_RACK_HIJACK,
+  NUM_KEYS
+};
+
+static const char *key_names[NUM_KEYS] = {
+  "REQUEST_METHOD",
+  "SCRIPT_NAME",
+  "PATH_INFO",
+  "QUERY_STRING",
+  "CONTENT_TYPE",
+  "CONTENT_LENGTH",
+  "SERVER_NAME",
+  "SERVER_PORT",
+  "SERVER_PROTOCOL",
+  "REMOTE_ADDR",
+  "rack.version",
+  "rack.url_scheme",
+  "rack.input",
+  "rack.errors",
+  "rack.multithread",
+  "rack.multiprocess",
+  "rack.run_once",
+  "rack.hijack?",
+};
+
+static VALUE keys[NUM_KEYS];
+static VALUE empty_string;
+static VALUE http_string;
+static VALUE https_string;
+
+static VALUE frozen_string(const char *str, long length)
+{
+  return rb_obj_freeze(rb_str_new(str, length));
+}
+
+/*
+Set an env item from a field of the table on the top of the Lua stack.
+*/
+static void set_field_item(lua_State *l, VALUE env, VALUE key, const char *field)
+{
+  lua_getfield(l, -1, field);
+  size_t length;
+  const char *value = lua_tolstring(l, -1, &length);
+  if (value)
+  {
+    rb_hash_aset(env, key, rb_str_new(value, length));
+  }
+  lua_pop(l, 1);
+}
+
+static VALUE build_env(lua_State *l)
+{
+  VALUE env = rb_hash_new();
+  input_data *input = DATA_PTR(input_object);
+  lua_getfield(l, 1, "request");
+  set_field_item(l, env, keys[KEY_REQUEST_METHOD], "method");
+  set_field_item(l, env, keys[KEY_PATH_INFO], "uri_path");
+  set_field_item(l, env, keys[KEY_SERVER_PROTOCOL], "version");
+  lua_getfield(l, -1, "uri");
+  const char *uri = lua_tostring(l, -1);
+  const char *query = uri ? strchr(uri, '?') : NULL;
+  rb_hash_aset(env, keys[KEY_QUERY_STRING], query ? rb_str_new_cstr(query + 1) :
+    rb_str_new(NULL, 0));
+  lua_pop(l, 1);
+  VALUE server_name = Qnil;
+  lua_getfield(l, -1, "headers");
+  lua_pushnil(l);
+  while (lua_next(l, -2))
+  {
+    size_t name_length;
+    size_t value_length;
+    const char *name = lua_tolstring(l, -2, &name_length);
+    const char *value = lua_tolstring(l, -1, &value_length);
+    if (name && value)
+    {
+      VALUE value_str = rb_str_new(value, value_length);
+      if (strcmp(name, "content-type") == 0)
+      {
+        rb_hash_aset(env, keys[KEY_CONTENT_TYPE], value_str);
+      }
+      else if (strcmp(name, "content-length") == 0)
+      {
+        rb_hash_aset(env, keys[KEY_CONTENT_LENGTH], value_str);
+        input->remaining = strtol(value, NULL, 10);
+      }
+      else
+      {
+        if (strcmp(name, "host") == 0)
+        {
+          const char *colon = strchr(value, ':');
+          server_name = rb_str_new(value, colon ? colon - value : (long)value_length);
+        }
+        char key[256] = "HTTP_";
+        size_t i;
+        for (i = 0; i < name_length && i + 6 < sizeof(key); ++i)
+        {
+          key[i + 5] = name[i] == '-' ? '_' : toupper((unsigned char)name[i]);
+        }
+        rb_hash_aset(env, frozen_string(key, i + 5), value_str);
+      }
+    }
+    lua_pop(l, 1);
+  }
+  lua_pop(l, 2);
+  lua_getfield(l, 1, "listen_address");
+  const char *listen_address = lua_tostring(l, -1);
+  const char *port = listen_address ? strrchr(listen_address, ':') : NULL;
+  rb_hash_aset(env, keys[KEY_SERVER_PORT], rb_str_new_cstr(port ? port + 1 : ""));
+  if (NIL_P(server_name) && port)
+  {
+    server_name = rb_str_new(listen_address, port - listen_address);
+  }
+  lua_pop(l, 1);
+  if (!NIL_P(server_name))
+  {
+    rb_hash_aset(env, keys[KEY_SERVER_NAME], server_name);
+  }
+  lua_getfield(l, 1, "client_address");
+  if (lua_istable(l, -1))
+  {
+    set_field_item(l, env, keys[KEY_REMOTE_ADDR], "addr");
+  }
+  lua_pop(l, 1);
+  rb_hash_aset(env, keys[KEY_SCRIPT_NAME], empty_string);
+  rb_hash_aset(env, keys[KEY_RACK_VERSION], rack_version);
+  lua_getfield(l, 1, "tls");
+  rb_hash_aset(env, keys[KEY_RACK_URL_SCHEME], 
+    lua_isnil(l, -1) ? http_string : https_string);
+  lua_pop(l, 1);
+  rb_hash_aset(env, keys[KEY_RACK_INPUT], input_object);
+  rb_hash_aset(env, keys[KEY_RACK_ERRORS], rb_stderr);
+  rb_hash_aset(env, keys[KEY_RACK_MULTITHREAD], Qfalse);
+  rb_hash_aset(env, keys[KEY_RACK_MULTIPROCESS], Qtrue);
+  rb_hash_aset(env, keys[KEY_RACK_RUN_ONCE], Qfalse);
+  rb_hash_aset(env, keys[KEY_RACK_HIJACK], Qfalse);
+  return env;
+}
+
+/*
+Add a response header. Unlike set_header(), a repeated header such as Set-Cookie is kept
+as a list of values instead of replacing the previous value.
+*/
+static void add_header(lua_State *l, const char *name, const char *value)
+{
+  char lower[256];
+  size_t length = strlen(name);
+  if (length >= sizeof(lower))
+  {
+    set_header((servlet*)l, name, value);
+    return;
+  }
+  for (size_t i = 0; i <= length; ++i)
+  {
+    lower[i] = tolower((unsigned char)name[i]);
+  }
+  lua_getfield(l, 1, "response_headers");
+  lua_getfield(l, -1, lower);
+  if (!lua_istable(l, -1))
+  {
+    lua_pop(l, 2);
+    set_header((servlet*)l, name, value);
+    return;
+  }
+  lua_getfield(l, -1, "value");
+  if (!lua_istable(l, -1))
+  {
+    lua_createtable(l, 2, 0);
+    lua_insert(l, -2);
+    lua_rawseti(l, -2, 1);
+    lua_pushvalue(l, -1);
+    lua_setfield(l, -3, "value");
+  }
+  lua_pushstring(l, value);
+  lua_rawseti(l, -2, lua_rawlen(l, -2) + 1);
+  lua_pop(l, 3);
+}
+
+/*
+Rack 2 separates multiple values of a header with newlines. Rack 3 uses an array.
+*/
+static int add_header_i(VALUE key, VALUE value, VALUE arg)
+{
+  lua_State *l = (lua_State*)arg;
+  const char *name = StringValueCStr(key);
+  if (strncmp(name, "rack.", 5) == 0)
+  {
+    return ST_CONTINUE;
+  }
+  if (RB_TYPE_P(value, T_ARRAY))
+  {
+    for (long i = 0; i < RARRAY_LEN(value); ++i)
+    {
+      VALUE item = rb_ary_entry(value, i);
+      add_header(l, name, StringValueCStr(item));
+    }
+    return ST_CONTINUE;
+  }
+  const char *str = StringValueCStr(value);
+  const char *newline;
+  while ((newline = strchr(str, '\n')))
+  {
+    VALUE line = rb_str_new(str, newline - str);
+    add_header(l, name, StringValueCStr(line));
+    str = newline + 1;
+  }
+  add_header(l, name, str);
+  return ST_CONTINUE;
+}
+
+static VALUE write_body_i(RB_BLOCK_CALL_FUNC_ARGLIST(chunk, data))
+{
+  return servlet_rwrite(servlet_object, chunk);
+}
+
+static VALUE each_body(VALUE body)
+{
+  return rb_block_call(body, id_each, 0, NULL, write_body_i, Qnil);
+}
+
+static VALUE close_body(VALUE body)
+{
+  if (rb_respond_to(body, id_close))
+  {
+    rb_funcall(body, id_close, 0);
+  }
+  return Qnil;
+}
+
+struct rack_call
+{
+  VALUE app;
+  lua_State *l;
+};
+
+static VALUE call_rack(VALUE arg)
+{
+  struct rack_call *call = (struct rack_call*)arg;
+  lua_State *l = call->l;
+  VALUE env = build_env(l);
+  VALUE response = rb_funcall(call->app, id_call, 1, env);
+  response = rb_check_array_type(response);
+  if (NIL_P(response) || RARRAY_LEN(response) != 3)
+  {
+    rb_raise(rb_eTypeError, "a Rack application must return [status, headers, body]");
+  }
+  set_status((servlet*)l, NUM2INT(rb_ary_entry(response, 0)));
+  VALUE headers = rb_ary_entry(response, 1);
+  if (!NIL_P(headers))
+  {
+    rb_hash_foreach(rb_convert_type(headers, T_HASH, "Hash", "to_hash"), add_header_i,
+      (VALUE)l);
+  }
+  VALUE body = rb_ary_entry(response, 2);
+  rb_ensure(each_body, body, close_body, body);
+  if (!headers_written(l) && !has_response_header(l, "content-length"))
+  {
+    /*
+    An empty body still sends the status the application chose rather than the 204 the
+    server sends for a servlet that writes nothing.
+    */
+    set_header((servlet*)l, "Content-Length", "0");
+    lua_getfield(l, 1, "write_status_line_and_headers");
+    lua_pushvalue(l, 1);
+    if (lua_pcall(l, 1, 0, 0) != LUA_OK)
+    {
+      lua_pop(l, 1);
+    }
+  }
+  return Qnil;
+}
+
+static int rack_run(lua_State *l)
+{
+  VALUE *app = luaL_checkudata(l, lua_upvalueindex(1), RUBY_SERVLET);
+  servlet_data *data = DATA_PTR(servlet_object);
+  input_data *input = DATA_PTR(input_object);
+  data->s = (struct servlet*)l;
+  lua_getfield(l, 1, "clientfd_read");
+  luaL_Stream *stream = luaL_testudata(l, -1, LUA_FILEHANDLE);
+  lua_pop(l, 1);
+  input->f = stream ? stream->f : NULL;
+  input->remaining = 0;
+  struct rack_call call = {*app, l};
+  int state;
+  rb_protect(call_rack, (VALUE)&call, &state);
+  data->s = NULL;
+  input->f = NULL;
+  if (state)
+  {
+    print_exception();
+    internal_server_error(l);
+  }
+  return 0;
+}
+
+static const char builder_rb[] =
+  "module Modserver\n"
+  "  class Builder\n"
+  "    def initialize\n"
+  "      @middleware = []\n"
+  "      @app = nil\n"
+  "    end\n"
+  "    def use(middleware, *args, &block)\n"
+  "      @middleware << proc { |app| middleware.new(app, *args, &block) }\n"
+  "    end\n"
+  "    def run(app)\n"
+  "      @app = app\n"
+  "    end\n"
+  "    def to_app\n"
+  "      raise 'the rackup file must call run(app)' unless @app\n"
+  "      @middleware.reverse.inject(@app) { |app, middleware| middleware.call(app) }\n"
+  "    end\n"
+  "  end\n"
+  "end\n";
+
 static int mod_init(lua_State *l)
 {
   int ret = ruby_setup();
@@ -88,80 +741,146 @@ static int mod_init(lua_State *l)
     return luaL_error(l, "ruby_setup: %d", ret);
   }
   ruby_init_loadpath();
-  
+
+  id_call = rb_intern("call");
+  id_run = rb_intern("run");
+  id_module_eval = rb_intern("module_eval");
+  id_extend = rb_intern("extend");
+  id_each = rb_intern("each");
+  id_close = rb_intern("close");
+  id_to_app = rb_intern("to_app");
+  id_message = rb_intern("message");
+  id_backtrace = rb_intern("backtrace");
+  id_join = rb_intern("join");
+
   rb_define_global_function("get_arg", api_get_arg, 2);
   rb_define_global_function("get_method", api_get_method, 1);
   rb_define_global_function("get_header", api_get_header, 2);
   rb_define_global_function("set_status", api_set_status, 2);
   rb_define_global_function("set_header", api_set_header, 3);
   rb_define_global_function("rwrite", api_rwrite, 2);
+  rb_define_global_function("rwritev", api_rwritev, 2);
   rb_define_global_function("rflush", api_rflush, 1);
-  
-  // VALUE api = rb_define_module("Api");
-  // rb_define_module_function(api, "rwrite", api_rwrite, 0);
-  // rb_define_const(mRUBBER, "TestConst", INT2NUM(38));
-  
+
+  VALUE modserver = rb_define_module("Modserver");
+  VALUE servlet_class = rb_define_class_under(modserver, "Servlet", rb_cObject);
+  rb_undef_alloc_func(servlet_class);
+  rb_define_method(servlet_class, "get_arg", servlet_get_arg, 1);
+  rb_define_method(servlet_class, "get_method", servlet_get_method, 0);
+  rb_define_method(servlet_class, "get_header", servlet_get_header, 1);
+  rb_define_method(servlet_class, "set_status", servlet_set_status, 1);
+  rb_define_method(servlet_class, "set_header", servlet_set_header, 2);
+  rb_define_method(servlet_class, "rwrite", servlet_rwrite, 1);
+  rb_define_method(servlet_class, "rwritev", servlet_rwritev, 1);
+  rb_define_method(servlet_class, "rflush", servlet_rflush, 0);
+  servlet_data *data;
+  servlet_object = TypedData_Make_Struct(servlet_class, servlet_data, &servlet_type, data);
+  data->s = NULL;
+  rb_gc_register_address(&servlet_object);
+
+  VALUE input_class = rb_define_class_under(modserver, "Input", rb_cObject);
+  rb_undef_alloc_func(input_class);
+  rb_define_method(input_class, "read", input_read, -1);
+  rb_define_method(input_class, "gets", input_gets, 0);
+  rb_define_method(input_class, "each", input_each, 0);
+  rb_define_method(input_class, "rewind", input_rewind, 0);
+  rb_define_method(input_class, "close", input_close, 0);
+  input_data *input;
+  input_object = TypedData_Make_Struct(input_class, input_data, &input_type, input);
+  input->f = NULL;
+  input->remaining = 0;
+  rb_gc_register_address(&input_object);
+
+  for (int i = 0; i < NUM_KEYS; ++i)
+  {
+    keys[i] = frozen_string(key_names[i], strlen(key_names[i]));
+    rb_gc_register_address(&keys[i]);
+  }
+  empty_string = frozen_string("", 0);
+  rb_gc_register_address(&empty_string);
+  http_string = frozen_string("http", 4);
+  rb_gc_register_address(&http_string);
+  https_string = frozen_string("https", 5);
+  rb_gc_register_address(&https_string);
+  rack_version = rb_obj_freeze(rb_ary_new_from_args(2, INT2FIX(1), INT2FIX(3)));
+  rb_gc_register_address(&rack_version);
+  loaded_servlets = rb_ary_new();
+  rb_gc_register_address(&loaded_servlets);
+
+  int state;
+  rb_eval_string_protect(builder_rb, &state);
+  if (state)
+  {
+    print_exception();
+    return luaL_error(l, "unable to define Modserver::Builder");
+  }
+  rack_builder = rb_path2class("Modserver::Builder");
   return 0;
 }
 
-static int servlet_run(lua_State *l)
+struct load_args
+{
+  const char *path;
+  int rackup;
+};
+
+/*
+Evaluate the servlet source in a new anonymous module so each servlet has its own run()
+and helper methods. The source is read and evaluated in memory.
+*/
+static VALUE load_servlet(VALUE arg)
+{
+  struct load_args *args = (struct load_args*)arg;
+  VALUE path = rb_str_new_cstr(args->path);
+  VALUE source = rb_funcall(rb_cFile, rb_intern("read"), 1, path);
+  if (args->rackup)
+  {
+    VALUE builder = rb_class_new_instance(0, NULL, rack_builder);
+    rb_funcall(builder, rb_intern("instance_eval"), 3, source, path, INT2FIX(1));
+    return rb_funcall(builder, id_to_app, 0);
+  }
+  VALUE module = rb_module_new();
+  rb_funcall(module, id_module_eval, 3, source, path, INT2FIX(1));
+  rb_funcall(module, id_extend, 1, module);
+  if (!rb_respond_to(module, id_run))
+  {
+    rb_raise(rb_eNameError, "the servlet does not define run(s): %s", args->path);
+  }
+  return module;
+}
+
+static int ruby_servlet_gc(lua_State *l)
 {
-  VALUE servlet = (VALUE)lua_touserdata(l, lua_upvalueindex(1));
-  VALUE ptr = ULL2NUM((unsigned long long)l);
-  // FIXME: need to catch possible exceptions or the Ruby VM will segfault
-  rb_funcall(servlet, rb_intern("call"), 1, ptr);
+  VALUE *servlet = luaL_checkudata(l, 1, RUBY_SERVLET);
+  rb_ary_delete(loaded_servlets, *servlet);
   return 0;
 }
 
 static int mod_load_servlet(lua_State *l)
 {
   const char *path = luaL_checkstring(l, -1);
-  
-  int ok = luaL_loadstring(l, 
-    "local path = ...\n"
-    "local f = io.open(path)\n"
-    "local str = f:read([[*all]])\n"
-    "f:close()\n"
-    "str = str .. [[$servlet_run = lambda {|s| run(s) }]]\n"
-    "local tmp_path = path .. [[.tmpfile]]\n"
-    "f = io.open(tmp_path, [[w+]])\n"
-    "f:write(str)\n"
-    "f:close()\n"
-    "return str, ([[./]] .. tmp_path)\n"
-  );
-  if (ok != LUA_OK)
-  {
-    return luaL_error(l, lua_tostring(l, -1));
-  }
-  lua_pushstring(l, path);
-  lua_call(l, 1, 2);
-  const char *servlet_rb = luaL_checkstring(l, -2);
-  const char *tmp_path = luaL_checkstring(l, -1);
-  
-  int status;
-  // VALUE result = rb_eval_string_protect(servlet_rb, &status);
-  VALUE script = rb_str_new_cstr(tmp_path);
-  rb_load_protect(script, 1, &status);
-  remove(tmp_path);
-  if (status != 0)
-  {
-    VALUE rbError = rb_funcall(rb_gv_get("$!"), rb_intern("message"), 0);
-    return luaL_error(l, "rb_load_protect: %s", StringValuePtr(rbError));
-  }
-  VALUE servlet = rb_gv_get("$servlet_run");
-  // printf("%lu\n", servlet);
-  
+  size_t length = strlen(path);
+  struct load_args args = {path, length > 3 && strcmp(path + length - 3, ".ru") == 0};
+  int state;
+  VALUE servlet = rb_protect(load_servlet, (VALUE)&args, &state);
+  if (state)
+  {
+    print_exception();
+    return luaL_error(l, "unable to load servlet: %s", path);
+  }
+  rb_ary_push(loaded_servlets, servlet);
   lua_newtable(l);
-  lua_pushlightuserdata(l, (void*)servlet);
-  lua_pushcclosure(l, servlet_run, 1);
+  VALUE *ud = lua_newuserdata(l, sizeof(VALUE));
+  *ud = servlet;
+  luaL_setmetatable(l, RUBY_SERVLET);
+  lua_pushcclosure(l, args.rackup ? rack_run : servlet_run, 1);
   lua_setfield(l, -2, "run");
-  
-  VALUE result = rb_eval_string_protect("$servlet_run = nil", &status);
   return 1;
 }
 
 static int mod_cleanup(lua_State *l)
 {
+  (void)l;
   ruby_cleanup(0);
   return 0;
 }
@@ -176,6 +895,10 @@ static const luaL_Reg module_ruby[] =
 
 LUALIB_API int luaopen_module_ruby(lua_State *l)
 {
+  luaL_newmetatable(l, RUBY_SERVLET);
+  lua_pushcfunction(l, ruby_servlet_gc);
+  lua_setfield(l, -2, "__gc");
+  lua_pop(l, 1);
   luaL_newlib(l, module_ruby);
   return 1;
 }
@@ -185,6 +908,7 @@ LUALIB_API int luaopen_module_ruby(lua_State *l)
 // https://silverhammermba.github.io/emberb/examples/
 // https://ruby-hacking-guide.github.io/load.html
 // https://github.com/andremedeiros/ruby-c-cheat-sheet
+// https://github.com/rack/rack/blob/main/SPEC.rdoc
 // https://fossies.org/linux/www/elinks-0.12pre6.tar.gz/elinks-0.12pre6/src/scripting/ruby/core.c
 // "Re: Loading a module without polluting my namespace"
 // https://www.ruby-forum.com/topic/211449#918804
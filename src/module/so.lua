@@ -1,11 +1,69 @@
 local mod = {}
 
+local native = require("native")
+local stdlib = require("posix.stdlib")
+local unistd = require("posix.unistd")
+
+--[[
+Libraries loaded by this process, by path. A version 2 servlet is unloaded only after the
+new copy of it has loaded, so a reload that fails leaves the old servlet in place.
+--]]
+local libraries = {}
+
+--[[
+dlopen() returns the library it already loaded for the same file name, so the new copy of
+a loaded library is opened through a symbolic link with a name of its own. The link is
+removed once the library is loaded.
+--]]
+local function load_again(path)
+  local realpath, errmsg = stdlib.realpath(path)
+  if not realpath then
+    return nil, errmsg
+  end
+  local tmpdir = os.getenv("TMPDIR") or "/tmp"
+  local dir
+  dir, errmsg = stdlib.mkdtemp(tmpdir .. "/modserver-XXXXXX")
+  if not dir then
+    return nil, errmsg
+  end
+  local link = dir .. "/" .. realpath:match("[^/]*$")
+  local library, abi
+  library, abi = unistd.link(realpath, link, true)
+  if library then
+    library, abi = native.load(link)
+    os.remove(link)
+  end
+  unistd.rmdir(dir)
+  return library, abi
+end
+
 function mod.load_servlet(path)
+  local previous = libraries[path]
+  local library, abi
+  if previous then
+    library, abi = load_again(path)
+  else
+    library, abi = native.load(path)
+  end
+  if not library then
+    error(abi)
+  end
+  if previous then
+    native.unload(previous)
+    libraries[path] = nil
+  end
   local servlet = {
-    -- init is optional.
-    init = package.loadlib(path, "init"),
-    run = assert(package.loadlib(path, "run")),
+    library = library,
+    -- init and cleanup are optional.
+    init = native.bind(library, "init"),
+    run = native.bind(library, "run"),
+    cleanup = native.bind(library, "cleanup"),
+    -- The language runtime of a version 1 servlet may not survive being unloaded.
+    reloadable = abi >= 2,
   }
+  if servlet.reloadable then
+    libraries[path] = library
+  end
   return servlet
 end
 
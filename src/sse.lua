@@ -0,0 +1,234 @@
+--[[
+Server-Sent Events. sse_start() turns a response into a long-lived event stream that is
+deferred to the event loop of the child, so one child holds any number of streams.
+sse_send() writes one event as a single chunk and flushes it with one write.
+
+sse_subscribe() adds the stream to a broadcast channel declared with the
+broadcast_channel directive. A message published to the channel from any child is
+formatted once and stored in shared memory. Each child reads it once and writes the same
+bytes to all of its subscribers.
+--]]
+local sse = {}
+
+local config = require("config")
+local cutil = require("cutil")
+local event = require("event")
+
+-- Format an event in the text/event-stream format. Each line of data becomes a data field.
+function sse.format(name, data, id)
+  local lines = {}
+  if id then
+    table.insert(lines, "id: " .. (tostring(id):gsub("[\r\n]", "")))
+  end
+  if name then
+    table.insert(lines, "event: " .. (tostring(name):gsub("[\r\n]", "")))
+  end
+  data = tostring(data or ""):gsub("\r\n?", "\n")
+  for line in (data .. "\n"):gmatch("([^\n]*)\n") do
+    table.insert(lines, "data: " .. line)
+  end
+  table.insert(lines, "\n")
+  return table.concat(lines, "\n")
+end
+
+local function set_headers(state)
+  if not state.response_headers["content-type"] then
+    state:set_header("Content-Type", "text/event-stream")
+  end
+  state:set_header("Cache-Control", "no-cache")
+end
+
+--[[
+Write a formatted frame and flush it. Once the stream is deferred, rwrite() hands the chunk
+to the event loop, which queues what the socket does not take so that a slow client does
+not hold up the child. A failed write is remembered in response_error so that the stream
+is finished at the next heartbeat or message.
+--]]
+local function write(state, frame)
+  if not state.response_error then
+    state:rwrite(frame)
+  end
+  if not state.response_error and not state.deferred then
+    local ok, errmsg = state.clientfd_write:flush()
+    if not ok then
+      state.response_error = errmsg
+    end
+  end
+  return not state.response_error
+end
+
+function sse.send(state, name, data, id)
+  if not state.response_headers_written then
+    set_headers(state)
+  end
+  return write(state, sse.format(name, data, id))
+end
+
+local function heartbeat(state)
+  local interval = config.cfg.sse_heartbeat
+  if interval > 0 then
+    event.timer(state, interval * 1000, function(self)
+      -- A comment line. Browsers ignore it.
+      if write(self, ":\n\n") then
+        heartbeat(self)
+      else
+        self:finish()
+      end
+    end)
+  end
+end
+
+--[[
+Send the headers at once so that the client sees the stream open, and defer the request
+without the deferred_timeout limit. Heartbeats find the clients that have left.
+--]]
+function sse.start(state)
+  if state.sse then
+    return
+  end
+  state.sse = true
+  set_headers(state)
+  state:defer()
+  state.deferred_timeout = 0
+  if not state.response_headers_written then
+    state:write_status_line_and_headers()
+  end
+  write(state, "")
+  heartbeat(state)
+end
+
+-- The subscribers of this child by channel name.
+local groups = {}
+
+--[[
+How long a message may stay unwritten after its writer took its sequence number. A writer 
+that died leaves it so, and the messages after it are delivered once this has passed.
+--]]
+local STALL_TIMEOUT = 2000
+
+-- Read the new messages of the channel and write them to each subscriber of this child.
+local function deliver(group)
+  local frames = {}
+  while true do
+    local message, oldest = group.channel:read(group.next)
+    if message then
+      table.insert(frames, message)
+      group.next = group.next + 1
+      group.stalled = nil
+    elseif message == false then
+      -- This child fell more than a ring behind. Skip the messages that were lost.
+      group.next = oldest
+      group.stalled = nil
+    elseif group.next < group.channel:head() then
+      -- The writer of the message is not done.
+      local now = cutil.now()
+      group.stalled = group.stalled or now
+      if now - group.stalled < STALL_TIMEOUT then
+        break
+      end
+      group.next = group.next + 1
+      group.stalled = nil
+    else
+      break
+    end
+  end
+  local chunk = #frames > 0 and table.concat(frames)
+  for state in pairs(group.states) do
+    if state.finished or (chunk and not write(state, chunk)) then
+      group.states[state] = nil
+      group.count = group.count - 1
+      state:finish()
+    end
+  end
+end
+
+local function poll_channel(group)
+  event.timer(nil, group.interval, function()
+    deliver(group)
+    if group.count > 0 then
+      poll_channel(group)
+    else
+      group.polling = false
+    end
+  end)
+end
+
+function sse.subscribe(state, name)
+  local channel = config.channels[name]
+  if not channel then
+    error(("no broadcast channel named %q"):format(tostring(name)))
+  end
+  sse.start(state)
+  local group = groups[name]
+  if not group then
+    group = {channel = channel.channel, interval = channel.interval, states = {}, count = 0}
+    groups[name] = group
+  end
+  if not group.polling then
+    group.polling = true
+    group.next = group.channel:head()
+    poll_channel(group)
+  end
+  if not group.states[state] then
+    group.states[state] = true
+    group.count = group.count + 1
+  end
+end
+
+-- Return the sequence number of the message, or nil and an error message.
+function sse.publish(name, event_name, data, id)
+  local channel = config.channels[name]
+  if not channel then
+    return nil, ("no broadcast channel named %q"):format(tostring(name))
+  end
+  return channel.channel:publish(sse.format(event_name, data, id))
+end
+
+-- Tests below this line:
+------------------------------------------------------------------------------------------
+
+if os.getenv("TEST") == "1" then
+  assert(sse.format(nil, "hello") == "data: hello\n\n")
+  assert(sse.format("tick", "a\r\nb\rc", 7) == "id: 7\nevent: tick\ndata: a\ndata: b\ndata: c\n\n")
+  assert(sse.format("x\ny", "") == "event: xy\ndata: \n\n")
+
+  local channel = cutil.broadcast(2, 8)
+  assert(channel:head() == 0)
+  assert(channel:read(0) == nil)
+  assert(channel:publish("one") == 0)
+  assert(channel:publish("two") == 1)
+  assert(channel:read(0) == "one" and channel:read(1) == "two")
+  assert(channel:publish("three") == 2)
+  local message, oldest = channel:read(0)
+  assert(message == false and oldest == 1)
+  assert(channel:read(2) == "three")
+  assert(channel:publish("too long for a slot") == nil)
+
+  -- A writer that dies after taking a sequence number does not stop the messages after it.
+  do
+    local received = {}
+    local subscriber = {
+      rwrite = function(self, frame) table.insert(received, frame) end,
+      clientfd_write = {flush = function() return true end},
+    }
+    local group = {channel = cutil.broadcast(2, 8), next = 0, states = {[subscriber] = true},
+      count = 1}
+    assert(group.channel:abandon() == 0)
+    assert(group.channel:publish("b") == 1)
+    deliver(group)
+    assert(#received == 0 and group.next == 0)
+    group.stalled = cutil.now() - STALL_TIMEOUT
+    deliver(group)
+    assert(table.concat(received) == "b" and group.next == 2)
+    -- The writer a ring later takes over the slot that was left unwritten.
+    assert(group.channel:abandon() == 2)
+    assert(group.channel:publish("d") == 3)
+    assert(group.channel:publish("e") == 4)
+    deliver(group)
+    assert(table.concat(received) == "bde" and group.next == 5)
+  end
+
+  print("sse.lua test complete")
+end
+
+return sse
@@ -0,0 +1,669 @@
+// fopencookie() is a GNU extension.
+#define _GNU_SOURCE
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lauxlib.h>
+#include <lua.h>
+#include "luacompat.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef MODSERVER_TLS
+#include <openssl/core_names.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#endif
+
+/*
+TLS termination with OpenSSL. The parent process makes a context for each listen directive
+with the tls option before it forks, so every child shares the certificate and the keys
+that encrypt session tickets. A client that resumes a session with a ticket from one
+child is accepted by any other child without a full handshake. The ticket keys live in
+shared memory, where the parent replaces them on a timer.
+
+After the handshake the records are handed to the kernel with kTLS when the kernel and the
+cipher allow it. The write stream is then an ordinary socket to the rest of the server,
+and writev() and sendfile() keep going straight to it. Otherwise the streams of the
+request encrypt and decrypt in user space through fopencookie(). The read stream always
+goes through SSL_read(), which also handles the records that are not application data,
+such as KeyUpdate, NewSessionTicket, and alerts, when the kernel decrypts.
+
+The server is built without TLS when OpenSSL is not found. See the Makefile.
+*/
+
+#define CONTEXT "ctls.context"
+
+static int push_error(lua_State *l, const char *message)
+{
+  lua_pushnil(l);
+#ifdef MODSERVER_TLS
+  unsigned long err = ERR_get_error();
+  if (err)
+  {
+    char reason[256];
+    ERR_error_string_n(err, reason, sizeof(reason));
+    lua_pushfstring(l, "%s: %s", message, reason);
+    ERR_clear_error();
+    return 2;
+  }
+#endif
+  lua_pushstring(l, message);
+  return 2;
+}
+
+/*
+Replace the stream of a Lua file with f. The file is made by io.open() so that it works
+with every Lua version, as in cutil.fdopen().
+*/
+static int push_file(lua_State *l, FILE *f, const char *mode)
+{
+  lua_getglobal(l, "io");
+  lua_getfield(l, -1, "open");
+  lua_pushliteral(l, "/dev/null");
+  lua_pushstring(l, mode);
+  lua_call(l, 2, 1);
+  luaL_Stream *stream = luaL_testudata(l, -1, LUA_FILEHANDLE);
+  lua_remove(l, -2);
+  if (!stream)
+  {
+    fclose(f);
+    return 0;
+  }
+  fclose(stream->f);
+  stream->f = f;
+  return 1;
+}
+
+#ifdef MODSERVER_TLS
+
+/*
+A session ticket key as SSL_CTX_set_tlsext_ticket_keys() takes it, and as a ticket_key
+file holds it: a 16 byte name, a 32 byte HMAC secret, and a 32 byte AES key.
+*/
+typedef struct ticket_key
+{
+  unsigned char name[16];
+  unsigned char hmac_secret[32];
+  unsigned char aes_key[32];
+} ticket_key;
+
+/*
+The ticket keys of a context, in memory shared with the children. Tickets are issued with
+the current key and accepted with the current and the previous one, so a ticket outlives
+one rotation. The parent is the only writer. It makes the version odd while it changes the
+keys, and a reader copies them again if the version was odd or changed during its copy,
+like a broadcast slot in util.c.
+*/
+typedef struct ticket_keys
+{
+  unsigned long version;
+  int has_previous;
+  ticket_key current;
+  ticket_key previous;
+} ticket_keys;
+
+typedef struct tls_context
+{
+  SSL_CTX *ctx;
+  // Offer HTTP/2 with ALPN. See h2.lua.
+  int http2;
+  ticket_keys *keys;
+  // The ticket_key file, or NULL for random keys.
+  char *ticket_key_path;
+  // Seconds between rotations of the ticket key, or 0 to keep it.
+  long rotation;
+  time_t next_rotation;
+} tls_context;
+
+static int read_ticket_key(const char *path, ticket_key *key)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+  {
+    return 0;
+  }
+  size_t count = fread(key, 1, sizeof(ticket_key), f);
+  fclose(f);
+  return count == sizeof(ticket_key);
+}
+
+static void get_ticket_keys(ticket_keys *keys, ticket_keys *copy)
+{
+  unsigned long version;
+  do
+  {
+    version = *(volatile unsigned long*)&keys->version;
+    __sync_synchronize();
+    memcpy(copy, keys, sizeof(ticket_keys));
+    __sync_synchronize();
+  }
+  while ((version & 1) || version != *(volatile unsigned long*)&keys->version);
+}
+
+// Make key the current key and the current key the previous one.
+static void set_ticket_key(ticket_keys *keys, const ticket_key *key)
+{
+  keys->version++;
+  __sync_synchronize();
+  keys->previous = keys->current;
+  keys->has_previous = 1;
+  keys->current = *key;
+  __sync_synchronize();
+  keys->version++;
+}
+
+/*
+Encrypt a new ticket with the current key, or find the key of a ticket to decrypt it. A
+ticket made with the previous key is accepted and replaced with one made with the current
+key.
+*/
+static int ticket_key_callback(SSL *ssl, unsigned char key_name[16], unsigned char *iv,
+  EVP_CIPHER_CTX *cipher, EVP_MAC_CTX *mac, int encrypt)
+{
+  tls_context *context = SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl));
+  ticket_keys keys;
+  get_ticket_keys(context->keys, &keys);
+  const ticket_key *key = &keys.current;
+  int ret = 1;
+  if (encrypt)
+  {
+    if (RAND_bytes(iv, EVP_CIPHER_get_iv_length(EVP_aes_256_cbc())) != 1)
+    {
+      return -1;
+    }
+    memcpy(key_name, key->name, sizeof(key->name));
+  }
+  else if (memcmp(key_name, keys.current.name, sizeof(key->name)) != 0)
+  {
+    if (!keys.has_previous
+      || memcmp(key_name, keys.previous.name, sizeof(key->name)) != 0)
+    {
+      // A full handshake follows.
+      return 0;
+    }
+    key = &keys.previous;
+    ret = 2;
+  }
+  static char digest[] = "SHA256";
+  OSSL_PARAM params[] = {
+    OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, (void*)key->hmac_secret,
+      sizeof(key->hmac_secret)),
+    OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+    OSSL_PARAM_construct_end(),
+  };
+  if (EVP_MAC_CTX_set_params(mac, params) != 1
+    || EVP_CipherInit_ex(cipher, EVP_aes_256_cbc(), NULL, key->aes_key, iv, encrypt) != 1)
+  {
+    return -1;
+  }
+  return ret;
+}
+
+/*
+Choose the application protocol from the list the client offers. The server prefers h2,
+and a client that offers neither protocol gets HTTP/1.1 without ALPN.
+*/
+static int select_alpn(SSL *ssl, const unsigned char **out, unsigned char *out_length,
+  const unsigned char *in, unsigned int in_length, void *arg)
+{
+  (void)ssl;
+  tls_context *context = arg;
+  static const unsigned char protocols[] = "\x02h2\x08http/1.1";
+  const unsigned char *server = context->http2 ? protocols : protocols + 3;
+  unsigned int server_length = context->http2 ? 12 : 9;
+  if (SSL_select_next_proto((unsigned char**)out, out_length, server, server_length, in,
+    in_length) != OPENSSL_NPN_NEGOTIATED)
+  {
+    return SSL_TLSEXT_ERR_NOACK;
+  }
+  return SSL_TLSEXT_ERR_OK;
+}
+
+/*
+ctls.context{cert = path, key = path, ticket_key = path, ticket_key_rotation = seconds,
+ciphers = list, ktls = true, http2 = true} returns a context, or nil and an error message.
+
+Without a ticket_key file a random key is made here and replaced every
+ticket_key_rotation seconds, an hour by default, by rotate_ticket_keys(). Every child
+shares them, but a reload makes a new one and clients fall back to a full handshake once.
+A ticket_key file is read again at each rotation instead.
+*/
+static int ctls_context(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TTABLE);
+  lua_getfield(l, 1, "cert");
+  const char *cert = luaL_optstring(l, -1, NULL);
+  lua_getfield(l, 1, "key");
+  const char *key = luaL_optstring(l, -1, cert);
+  lua_getfield(l, 1, "ticket_key");
+  const char *ticket_key_path = luaL_optstring(l, -1, NULL);
+  lua_getfield(l, 1, "ticket_key_rotation");
+  long rotation = luaL_optinteger(l, -1, 3600);
+  lua_getfield(l, 1, "ciphers");
+  const char *ciphers = luaL_optstring(l, -1, NULL);
+  lua_getfield(l, 1, "ktls");
+  int ktls = lua_isnil(l, -1) || lua_toboolean(l, -1);
+  lua_getfield(l, 1, "http2");
+  int http2 = lua_isnil(l, -1) || lua_toboolean(l, -1);
+  if (!cert)
+  {
+    return luaL_error(l, "tls needs a cert");
+  }
+  tls_context *context = lua_newuserdata(l, sizeof(tls_context));
+  memset(context, 0, sizeof(tls_context));
+  luaL_setmetatable(l, CONTEXT);
+  context->ctx = SSL_CTX_new(TLS_server_method());
+  if (!context->ctx)
+  {
+    return push_error(l, "SSL_CTX_new");
+  }
+  context->http2 = http2;
+  context->rotation = rotation;
+  context->next_rotation = time(NULL) + rotation;
+  void *keys = mmap(NULL, sizeof(ticket_keys), PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (keys == MAP_FAILED)
+  {
+    return push_error(l, strerror(errno));
+  }
+  context->keys = keys;
+  memset(context->keys, 0, sizeof(ticket_keys));
+  if (ticket_key_path && !(context->ticket_key_path = strdup(ticket_key_path)))
+  {
+    return push_error(l, strerror(ENOMEM));
+  }
+  SSL_CTX *ctx = context->ctx;
+  SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+  if (SSL_CTX_use_certificate_chain_file(ctx, cert) != 1)
+  {
+    return push_error(l, cert);
+  }
+  if (SSL_CTX_use_PrivateKey_file(ctx, key, SSL_FILETYPE_PEM) != 1
+    || SSL_CTX_check_private_key(ctx) != 1)
+  {
+    return push_error(l, key);
+  }
+  if (ciphers && SSL_CTX_set_cipher_list(ctx, ciphers) != 1)
+  {
+    return push_error(l, "ciphers");
+  }
+  ticket_key *current = &context->keys->current;
+  if (ticket_key_path)
+  {
+    if (!read_ticket_key(ticket_key_path, current))
+    {
+      lua_pushnil(l);
+      lua_pushfstring(l, "%s: a ticket key is 80 bytes", ticket_key_path);
+      return 2;
+    }
+  }
+  else if (RAND_bytes((unsigned char*)current, sizeof(ticket_key)) != 1)
+  {
+    return push_error(l, "RAND_bytes");
+  }
+  // The userdata does not move, so the callbacks may keep a pointer to it.
+  SSL_CTX_set_app_data(ctx, context);
+  if (SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, ticket_key_callback) != 1)
+  {
+    return push_error(l, "SSL_CTX_set_tlsext_ticket_key_evp_cb");
+  }
+  // The session cache is per process and would miss in every other child. Tickets do not.
+  SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+  long options = SSL_OP_NO_RENEGOTIATION | SSL_OP_CIPHER_SERVER_PREFERENCE;
+#ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
+  // Most clients close the connection without a close_notify alert.
+  options |= SSL_OP_IGNORE_UNEXPECTED_EOF;
+#endif
+#ifdef SSL_OP_ENABLE_KTLS
+  if (ktls)
+  {
+    options |= SSL_OP_ENABLE_KTLS;
+  }
+#else
+  (void)ktls;
+#endif
+  SSL_CTX_set_options(ctx, options);
+  SSL_CTX_set_mode(ctx, SSL_MODE_AUTO_RETRY);
+  SSL_CTX_set_alpn_select_cb(ctx, select_alpn, context);
+  return 1;
+}
+
+/*
+context:rotate_ticket_keys() replaces the current ticket key once the rotation interval
+has passed and keeps the old one to accept the tickets made with it. A ticket_key file is
+read again, and the key only changes if the file did, so a new key written there is used
+within one interval. The parent calls this on each turn of its loop. It returns true if
+the key changed, or nil and an error message.
+*/
+static int context_rotate_ticket_keys(lua_State *l)
+{
+  tls_context *context = luaL_checkudata(l, 1, CONTEXT);
+  time_t now = time(NULL);
+  if (!context->keys || context->rotation <= 0 || now < context->next_rotation)
+  {
+    lua_pushboolean(l, 0);
+    return 1;
+  }
+  context->next_rotation = now + context->rotation;
+  ticket_key key;
+  if (context->ticket_key_path)
+  {
+    if (!read_ticket_key(context->ticket_key_path, &key))
+    {
+      lua_pushnil(l);
+      lua_pushfstring(l, "%s: a ticket key is 80 bytes", context->ticket_key_path);
+      return 2;
+    }
+    if (memcmp(&key, &context->keys->current, sizeof(key)) == 0)
+    {
+      lua_pushboolean(l, 0);
+      return 1;
+    }
+  }
+  else if (RAND_bytes((unsigned char*)&key, sizeof(key)) != 1)
+  {
+    return push_error(l, "RAND_bytes");
+  }
+  set_ticket_key(context->keys, &key);
+  lua_pushboolean(l, 1);
+  return 1;
+}
+
+static int context_gc(lua_State *l)
+{
+  tls_context *context = luaL_checkudata(l, 1, CONTEXT);
+  if (context->ctx)
+  {
+    SSL_CTX_free(context->ctx);
+    context->ctx = NULL;
+  }
+  if (context->keys)
+  {
+    munmap(context->keys, sizeof(ticket_keys));
+    context->keys = NULL;
+  }
+  free(context->ticket_key_path);
+  context->ticket_key_path = NULL;
+  return 0;
+}
+
+/*
+A connection read, and unless the kernel encrypts, written through OpenSSL. The streams
+that share it count their references, and the last one closed sends close_notify and
+closes the socket.
+*/
+typedef struct tls_connection
+{
+  SSL *ssl;
+  int fd;
+  int refs;
+  /*
+  The write stream goes straight to a copy of the socket, and may still hold data when the
+  read stream is closed, so no close_notify is sent after it.
+  */
+  int ktls_send;
+} tls_connection;
+
+// Return -1 with errno set for an SSL_read() or SSL_write() that failed.
+static ssize_t tls_failed(tls_connection *c, int ret)
+{
+  switch (SSL_get_error(c->ssl, ret))
+  {
+  case SSL_ERROR_ZERO_RETURN:
+    return 0;
+  case SSL_ERROR_WANT_READ:
+  case SSL_ERROR_WANT_WRITE:
+    // A nonblocking read found no whole record, or SO_RCVTIMEO expired.
+    errno = EAGAIN;
+    return -1;
+  case SSL_ERROR_SYSCALL:
+    ERR_clear_error();
+    if (errno == 0)
+    {
+      return 0;
+    }
+    return -1;
+  default:
+    ERR_clear_error();
+    errno = EIO;
+    return -1;
+  }
+}
+
+static ssize_t tls_read(void *cookie, char *buffer, size_t size)
+{
+  tls_connection *c = cookie;
+  errno = 0;
+  int ret = SSL_read(c->ssl, buffer, size > INT_MAX ? INT_MAX : (int)size);
+  return ret > 0 ? ret : tls_failed(c, ret);
+}
+
+static ssize_t tls_write(void *cookie, const char *buffer, size_t size)
+{
+  tls_connection *c = cookie;
+  size_t written = 0;
+  while (written < size)
+  {
+    size_t remaining = size - written;
+    errno = 0;
+    int length = remaining > INT_MAX ? INT_MAX : (int)remaining;
+    int ret = SSL_write(c->ssl, buffer + written, length);
+    if (ret <= 0)
+    {
+      tls_failed(c, ret);
+      if (errno == 0)
+      {
+        errno = EPIPE;
+      }
+      return written ? (ssize_t)written : -1;
+    }
+    written += ret;
+  }
+  return written;
+}
+
+static int tls_close(void *cookie)
+{
+  tls_connection *c = cookie;
+  if (--c->refs > 0)
+  {
+    return 0;
+  }
+  if (!c->ktls_send)
+  {
+    // Send close_notify without waiting for the answer of the client.
+    SSL_shutdown(c->ssl);
+  }
+  ERR_clear_error();
+  SSL_free(c->ssl);
+  int ret = close(c->fd);
+  free(c);
+  return ret;
+}
+
+static FILE* tls_stream(tls_connection *c, const char *mode)
+{
+  cookie_io_functions_t functions = {
+    .read = mode[0] == 'r' ? tls_read : NULL,
+    .write = mode[0] == 'w' ? tls_write : NULL,
+    .seek = NULL,
+    .close = tls_close,
+  };
+  FILE *f = fopencookie(c, mode, functions);
+  if (f)
+  {
+    c->refs++;
+    if (mode[0] == 'w')
+    {
+      // Fill whole records: a record holds up to 16 KB.
+      setvbuf(f, NULL, _IOFBF, 16384);
+    }
+  }
+  return f;
+}
+
+/*
+ctls.accept(context, fd) makes the TLS handshake on the accepted socket and returns the
+read and the write stream of the connection and a table that describes it. It returns nil
+and an error message if the handshake fails, in which case the caller closes fd. The
+streams own fd otherwise.
+
+The handshake blocks like the read of a request. SO_RCVTIMEO of the socket limits it.
+*/
+static int ctls_accept(lua_State *l)
+{
+  tls_context *context = luaL_checkudata(l, 1, CONTEXT);
+  int fd = luaL_checkinteger(l, 2);
+  SSL *ssl = SSL_new(context->ctx);
+  if (!ssl)
+  {
+    return push_error(l, "SSL_new");
+  }
+  ERR_clear_error();
+  if (SSL_set_fd(ssl, fd) != 1 || SSL_accept(ssl) != 1)
+  {
+    SSL_free(ssl);
+    return push_error(l, "TLS handshake failed");
+  }
+  int ktls_send = BIO_get_ktls_send(SSL_get_wbio(ssl));
+  int ktls_recv = BIO_get_ktls_recv(SSL_get_rbio(ssl));
+  const char *version = SSL_get_version(ssl);
+  const char *cipher = SSL_get_cipher_name(ssl);
+  int resumed = SSL_session_reused(ssl);
+  const unsigned char *alpn;
+  unsigned int alpn_length;
+  SSL_get0_alpn_selected(ssl, &alpn, &alpn_length);
+  char protocol[16] = "";
+  if (alpn && alpn_length < sizeof(protocol))
+  {
+    memcpy(protocol, alpn, alpn_length);
+    protocol[alpn_length] = 0;
+  }
+  tls_connection *c = calloc(1, sizeof(tls_connection));
+  if (!c)
+  {
+    SSL_free(ssl);
+    return push_error(l, strerror(ENOMEM));
+  }
+  c->ssl = ssl;
+  c->fd = fd;
+  c->ktls_send = ktls_send;
+  /*
+  Even when the kernel decrypts, the records that are not application data come to
+  OpenSSL, so the connection stays alive and reads go through SSL_read().
+  */
+  FILE *read_file = tls_stream(c, "r");
+  FILE *write_file = NULL;
+  if (!read_file)
+  {
+    SSL_free(c->ssl);
+    free(c);
+    return push_error(l, strerror(errno));
+  }
+  if (ktls_send)
+  {
+    // Writes go straight to the socket, which the kernel encrypts.
+    int fd2 = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    write_file = fd2 >= 0 ? fdopen(fd2, "w") : NULL;
+    if (fd2 >= 0 && !write_file)
+    {
+      close(fd2);
+    }
+  }
+  else
+  {
+    write_file = tls_stream(c, "w");
+  }
+  if (!write_file)
+  {
+    int err = errno;
+    fclose(read_file);
+    return push_error(l, strerror(err));
+  }
+  if (!push_file(l, read_file, "r"))
+  {
+    fclose(write_file);
+    return push_error(l, "unable to make a Lua file");
+  }
+  if (!push_file(l, write_file, "w"))
+  {
+    return push_error(l, "unable to make a Lua file");
+  }
+  lua_createtable(l, 0, 7);
+  lua_pushstring(l, version);
+  lua_setfield(l, -2, "version");
+  lua_pushstring(l, cipher);
+  lua_setfield(l, -2, "cipher");
+  lua_pushboolean(l, resumed);
+  lua_setfield(l, -2, "resumed");
+  lua_pushboolean(l, ktls_send);
+  lua_setfield(l, -2, "ktls_send");
+  lua_pushboolean(l, ktls_recv);
+  lua_setfield(l, -2, "ktls_recv");
+  if (protocol[0])
+  {
+    lua_pushstring(l, protocol);
+    lua_setfield(l, -2, "alpn");
+  }
+  /*
+  The socket, for poll(). The read stream has no descriptor, and neither has the write
+  stream without kTLS.
+  */
+  lua_pushinteger(l, fd);
+  lua_setfield(l, -2, "fd");
+  return 3;
+}
+
+static const luaL_Reg context_methods[] =
+{
+  {"__gc", context_gc},
+  {"rotate_ticket_keys", context_rotate_ticket_keys},
+  {NULL, NULL},
+};
+
+#else
+
+static int ctls_context(lua_State *l)
+{
+  return push_error(l, "modserver was built without OpenSSL");
+}
+
+static int ctls_accept(lua_State *l)
+{
+  (void)push_file;
+  return push_error(l, "modserver was built without OpenSSL");
+}
+
+#endif
+
+static const luaL_Reg ctls[] =
+{
+  {"accept", ctls_accept},
+  {"context", ctls_context},
+  {NULL, NULL},
+};
+
+LUALIB_API int luaopen_ctls(lua_State *l)
+{
+#ifdef MODSERVER_TLS
+  luaL_newmetatable(l, CONTEXT);
+  luaL_setfuncs(l, context_methods, 0);
+  lua_pushvalue(l, -1);
+  lua_setfield(l, -2, "__index");
+  lua_pop(l, 1);
+#endif
+  luaL_newlib(l, ctls);
+#ifdef MODSERVER_TLS
+  lua_pushboolean(l, 1);
+#else
+  lua_pushboolean(l, 0);
+#endif
+  lua_setfield(l, -2, "enabled");
+  return 1;
+}
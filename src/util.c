@@ -1,13 +1,40 @@
+// MAP_ANONYMOUS is not part of POSIX.1-2001 and is hidden by -std=c99 on glibc.
+#define _DEFAULT_SOURCE
 #include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <lauxlib.h>
 #include <lua.h>
 #include <lualib.h>
+#include "luacompat.h"
+#if LUA_VERSION_NUM == 502
+// Lua internals for luaU_dump(), as used by luac.
+#include <lobject.h>
+#include <lstate.h>
+#include <lundump.h>
+#endif
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <spawn.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/prctl.h>
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 /*
 Lua's file:read() function lacks a way to read a line of a limited length. That is an 
@@ -18,15 +45,14 @@ static int cutil_fgets(lua_State *l)
   luaL_Stream *stream = luaL_checkudata(l, -1, LUA_FILEHANDLE);
   int size = luaL_checknumber(l, -2);
   FILE *f = stream->f;
-  luaL_Buffer b;
-  luaL_buffinit(l, &b);
-  char *p = luaL_prepbuffsize(&b, size);
+  char stack_buffer[LUAL_BUFFERSIZE];
+  char *p = stack_buffer;
+  if ((size_t)size > sizeof(stack_buffer))
+  {
+    p = lua_newuserdata(l, size);
+  }
   if (fgets(p, size, f) == NULL)
   {
-    // discard the buffer
-    luaL_pushresult(&b);
-    lua_pop(l, 1);
-    
     lua_pushnil(l);
     if (feof(f))
     {
@@ -40,20 +66,1255 @@ static int cutil_fgets(lua_State *l)
     }
     return 3;
   }
-  size_t len = strlen(p);
-  luaL_addsize(&b, len);
+  lua_pushlstring(l, p, strlen(p));
+  return 1;
+}
+
+static int push_errno(lua_State *l)
+{
+  int err = errno;
+  lua_pushnil(l);
+  lua_pushstring(l, strerror(err));
+  lua_pushnumber(l, err);
+  return 3;
+}
+
+/*
+Return the peak resident set size of the calling process in bytes. Children compare this 
+against the max_worker_rss directive after each request.
+*/
+static int cutil_maxrss(lua_State *l)
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return push_errno(l);
+  }
+#ifdef __APPLE__
+  // Mac OS X reports ru_maxrss in bytes.
+  lua_pushnumber(l, usage.ru_maxrss);
+#else
+  // Everyone else reports ru_maxrss in kilobytes.
+  lua_pushnumber(l, (lua_Number)usage.ru_maxrss * 1024);
+#endif
+  return 1;
+}
+
+/*
+Return the time of a monotonic clock in milliseconds. The event loop of a child uses it 
+for the timers of deferred requests.
+*/
+static int cutil_now(lua_State *l)
+{
+  struct timespec now;
+  if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+  {
+    return push_errno(l);
+  }
+  lua_pushnumber(l, (lua_Number)now.tv_sec * 1000 + now.tv_nsec / 1000000.0);
+  return 1;
+}
+
+/*
+An array of counters in memory shared by the parent and every child. The memory is 
+mapped before the children are forked so they all see the same counters. Reads and 
+updates are atomic so no lock is needed.
+*/
+#define SHARED_COUNTERS "cutil.shared_counters"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+typedef struct shared_counters
+{
+  long *counters;
+  size_t count;
+} shared_counters;
+
+static int cutil_shared_counters(lua_State *l)
+{
+  size_t count = luaL_checkinteger(l, 1);
+  luaL_argcheck(l, count > 0, 1, "count must be positive");
+  shared_counters *sc = lua_newuserdata(l, sizeof(shared_counters));
+  sc->count = count;
+  sc->counters = mmap(NULL, count * sizeof(long), PROT_READ | PROT_WRITE, 
+    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (sc->counters == MAP_FAILED)
+  {
+    return push_errno(l);
+  }
+  // The mapping lives as long as the process. Children inherit it across fork().
+  luaL_setmetatable(l, SHARED_COUNTERS);
+  return 1;
+}
+
+static long* shared_counter(lua_State *l)
+{
+  shared_counters *sc = luaL_checkudata(l, 1, SHARED_COUNTERS);
+  lua_Integer index = luaL_checkinteger(l, 2);
+  luaL_argcheck(l, index >= 1 && (size_t)index <= sc->count, 2, "index out of range");
+  return &sc->counters[index - 1];
+}
+
+// counters:get(index)
+static int shared_counters_get(lua_State *l)
+{
+  long *counter = shared_counter(l);
+  lua_pushnumber(l, __sync_add_and_fetch(counter, 0));
+  return 1;
+}
+
+// counters:add(index, delta) returns the new value.
+static int shared_counters_add(lua_State *l)
+{
+  long *counter = shared_counter(l);
+  long delta = luaL_optinteger(l, 3, 1);
+  lua_pushnumber(l, __sync_add_and_fetch(counter, delta));
+  return 1;
+}
+
+static const luaL_Reg shared_counters_methods[] = 
+{
+  {"get", shared_counters_get},
+  {"add", shared_counters_add},
+  {NULL, NULL},
+};
+
+/*
+A broadcast channel: a ring of messages in shared memory. Any process appends messages 
+and every process reads them in order from its own position, so one message reaches the 
+subscribers of every child without a copy per child. A reader that falls more than a ring 
+behind loses the oldest messages.
+
+Each slot holds a sequence lock. A writer sets the version of the slot to an odd number 
+while it copies the message in and to the next even number when it is done. A reader 
+accepts the message only if the version was the expected even number both before and 
+after its copy.
+
+Once the ring wraps, the writer of a message and the writer of the message a ring earlier 
+share a slot. A writer claims the slot by swapping the version left by the earlier message 
+for its own odd number, so the two never copy at the same time. A writer that died after 
+taking its sequence number leaves the slot odd. The writer a ring later takes the slot 
+from it once it has waited long enough, and readers skip a message that stays unwritten 
+for long (see deliver() in sse.lua), so one lost message does not stall the channel.
+*/
+#define BROADCAST "cutil.broadcast"
+// How many times a writer yields to the writer a ring earlier before it gives up.
+#define BROADCAST_CLAIM_TRIES 10000
+
+typedef struct broadcast_slot
+{
+  unsigned long version;
+  size_t length;
+  char data[];
+} broadcast_slot;
+
+typedef struct broadcast
+{
+  // The number of messages ever published, in shared memory.
+  unsigned long *head;
+  char *slots;
+  size_t count;
+  size_t slot_size;
+  size_t stride;
+} broadcast;
+
+static broadcast_slot* broadcast_get_slot(broadcast *b, unsigned long sequence)
+{
+  return (broadcast_slot*)(b->slots + (sequence % b->count) * b->stride);
+}
+
+// cutil.broadcast(count, size) maps a ring of count messages of up to size bytes each.
+static int cutil_broadcast(lua_State *l)
+{
+  size_t count = luaL_checkinteger(l, 1);
+  size_t slot_size = luaL_checkinteger(l, 2);
+  luaL_argcheck(l, count > 0, 1, "count must be positive");
+  luaL_argcheck(l, slot_size > 0, 2, "size must be positive");
+  broadcast *b = lua_newuserdata(l, sizeof(broadcast));
+  b->count = count;
+  b->slot_size = slot_size;
+  size_t align = sizeof(unsigned long);
+  b->stride = (sizeof(broadcast_slot) + slot_size + align - 1) / align * align;
+  char *memory = mmap(NULL, align + count * b->stride, PROT_READ | PROT_WRITE, 
+    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)
+  {
+    return push_errno(l);
+  }
+  b->head = (unsigned long*)memory;
+  b->slots = memory + align;
+  luaL_setmetatable(l, BROADCAST);
+  return 1;
+}
+
+/*
+channel:publish(message) returns the sequence number of the message, or nil and an error 
+message if it is too large or its slot could not be claimed.
+*/
+static int broadcast_publish(lua_State *l)
+{
+  broadcast *b = luaL_checkudata(l, 1, BROADCAST);
+  size_t length;
+  const char *message = luaL_checklstring(l, 2, &length);
+  if (length > b->slot_size)
+  {
+    lua_pushnil(l);
+    lua_pushliteral(l, "the message is larger than the slots of the channel");
+    return 2;
+  }
+  unsigned long sequence = __sync_fetch_and_add(b->head, 1);
+  broadcast_slot *slot = broadcast_get_slot(b, sequence);
+  unsigned long expected = sequence >= b->count ? (sequence - b->count) * 2 + 2 : 0;
+  unsigned long claimed = sequence * 2 + 1;
+  int tries = 0;
+  while (!__sync_bool_compare_and_swap(&slot->version, expected, claimed))
+  {
+    unsigned long version = *(volatile unsigned long*)&slot->version;
+    if (version > claimed)
+    {
+      // A writer a ring later has taken the slot. Readers skip this message.
+      lua_pushnil(l);
+      lua_pushliteral(l, "the slot of the message is taken by another writer");
+      return 2;
+    }
+    if (++tries > BROADCAST_CLAIM_TRIES)
+    {
+      // The writer a ring earlier, or one before it, never finished. Take the slot over.
+      expected = version;
+      continue;
+    }
+    sched_yield();
+  }
+  memcpy(slot->data, message, length);
+  slot->length = length;
+  __sync_synchronize();
+  slot->version = sequence * 2 + 2;
+  lua_pushnumber(l, sequence);
+  return 1;
+}
+
+/*
+channel:abandon() takes the next sequence number and never writes it, as a writer that 
+dies does. For the tests.
+*/
+static int broadcast_abandon(lua_State *l)
+{
+  broadcast *b = luaL_checkudata(l, 1, BROADCAST);
+  unsigned long sequence = __sync_fetch_and_add(b->head, 1);
+  broadcast_slot *slot = broadcast_get_slot(b, sequence);
+  slot->version = sequence * 2 + 1;
+  lua_pushnumber(l, sequence);
+  return 1;
+}
+
+// channel:head() returns the sequence number the next message will have.
+static int broadcast_head(lua_State *l)
+{
+  broadcast *b = luaL_checkudata(l, 1, BROADCAST);
+  lua_pushnumber(l, __sync_add_and_fetch(b->head, 0));
+  return 1;
+}
+
+/*
+channel:read(sequence) returns the message, nil if it has not been published yet, or false 
+and the sequence number of the oldest message left if it was overwritten.
+*/
+static int broadcast_read(lua_State *l)
+{
+  broadcast *b = luaL_checkudata(l, 1, BROADCAST);
+  unsigned long sequence = luaL_checknumber(l, 2);
+  unsigned long head = __sync_add_and_fetch(b->head, 0);
+  if (sequence >= head)
+  {
+    lua_pushnil(l);
+    return 1;
+  }
+  unsigned long oldest = head > b->count ? head - b->count : 0;
+  broadcast_slot *slot = broadcast_get_slot(b, sequence);
+  unsigned long version = slot->version;
+  __sync_synchronize();
+  if (sequence >= oldest && version < sequence * 2 + 2)
+  {
+    // The writer has claimed the sequence number but is not done yet.
+    lua_pushnil(l);
+    return 1;
+  }
+  if (sequence >= oldest && version == sequence * 2 + 2)
+  {
+    size_t length = slot->length;
+    if (length <= b->slot_size)
+    {
+      char *copy = lua_newuserdata(l, length ? length : 1);
+      memcpy(copy, slot->data, length);
+      __sync_synchronize();
+      if (slot->version == version)
+      {
+        lua_pushlstring(l, copy, length);
+        return 1;
+      }
+    }
+  }
+  // A writer reused the slot. Skip to the oldest message still in the ring.
+  head = __sync_add_and_fetch(b->head, 0);
+  oldest = head > b->count ? head - b->count : 0;
+  lua_pushboolean(l, 0);
+  lua_pushnumber(l, oldest > sequence ? oldest : sequence + 1);
+  return 2;
+}
+
+static const luaL_Reg broadcast_methods[] = 
+{
+  {"publish", broadcast_publish},
+  {"abandon", broadcast_abandon},
+  {"head", broadcast_head},
+  {"read", broadcast_read},
+  {NULL, NULL},
+};
+
+/*
+SHA-1 as FIPS 180-4 describes it. The WebSocket handshake needs it to compute the 
+Sec-WebSocket-Accept header and nothing else, so it favors being short over being fast.
+*/
+static uint32_t rotl32(uint32_t x, int n)
+{
+  return (x << n) | (x >> (32 - n));
+}
+
+static void sha1_block(uint32_t h[5], const unsigned char *p)
+{
+  uint32_t w[80];
+  for (int i = 0; i < 16; ++i)
+  {
+    w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 | 
+      (uint32_t)p[i * 4 + 2] << 8 | p[i * 4 + 3];
+  }
+  for (int i = 16; i < 80; ++i)
+  {
+    w[i] = rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (int i = 0; i < 80; ++i)
+  {
+    uint32_t f, k;
+    if (i < 20)
+    {
+      f = (b & c) | (~b & d);
+      k = 0x5a827999;
+    }
+    else if (i < 40)
+    {
+      f = b ^ c ^ d;
+      k = 0x6ed9eba1;
+    }
+    else if (i < 60)
+    {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8f1bbcdc;
+    }
+    else
+    {
+      f = b ^ c ^ d;
+      k = 0xca62c1d6;
+    }
+    uint32_t t = rotl32(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rotl32(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+}
+
+// cutil.sha1(data) returns the 20 byte digest.
+static int cutil_sha1(lua_State *l)
+{
+  size_t length;
+  const unsigned char *data = (const unsigned char*)luaL_checklstring(l, 1, &length);
+  uint32_t h[5] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+  size_t i = 0;
+  for (; i + 64 <= length; i += 64)
+  {
+    sha1_block(h, data + i);
+  }
+  unsigned char last[128] = {0};
+  size_t rest = length - i;
+  memcpy(last, data + i, rest);
+  last[rest] = 0x80;
+  size_t last_size = rest < 56 ? 64 : 128;
+  uint64_t bits = (uint64_t)length * 8;
+  for (int j = 0; j < 8; ++j)
+  {
+    last[last_size - 1 - j] = bits >> (j * 8);
+  }
+  sha1_block(h, last);
+  if (last_size == 128)
+  {
+    sha1_block(h, last + 64);
+  }
+  unsigned char digest[20];
+  for (int j = 0; j < 20; ++j)
+  {
+    digest[j] = h[j / 4] >> (24 - (j % 4) * 8);
+  }
+  lua_pushlstring(l, (const char*)digest, sizeof(digest));
+  return 1;
+}
+
+// cutil.base64(data) returns the data in the base64 encoding of RFC 4648.
+static int cutil_base64(lua_State *l)
+{
+  static const char alphabet[] = 
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t length;
+  const unsigned char *data = (const unsigned char*)luaL_checklstring(l, 1, &length);
+  luaL_Buffer b;
+  luaL_buffinit(l, &b);
+  for (size_t i = 0; i < length; i += 3)
+  {
+    uint32_t n = (uint32_t)data[i] << 16;
+    if (i + 1 < length)
+    {
+      n |= (uint32_t)data[i + 1] << 8;
+    }
+    if (i + 2 < length)
+    {
+      n |= data[i + 2];
+    }
+    char out[4] = {
+      alphabet[n >> 18 & 63], 
+      alphabet[n >> 12 & 63], 
+      i + 1 < length ? alphabet[n >> 6 & 63] : '=', 
+      i + 2 < length ? alphabet[n & 63] : '=',
+    };
+    luaL_addlstring(&b, out, sizeof(out));
+  }
+  luaL_pushresult(&b);
+  return 1;
+}
+
+/*
+XOR the payload of a WebSocket frame with its four byte masking key. Every client frame is 
+masked, so this touches every byte a client sends. Sixteen bytes are done at a time with 
+SSE2 or NEON when the compiler targets them and eight at a time otherwise.
+*/
+static void ws_unmask(unsigned char *dst, const unsigned char *src, size_t length, 
+  const unsigned char key[4])
+{
+  size_t i = 0;
+  unsigned char pattern[16];
+  for (int j = 0; j < 16; ++j)
+  {
+    pattern[j] = key[j % 4];
+  }
+#if defined(__SSE2__)
+  __m128i mask = _mm_loadu_si128((const __m128i*)pattern);
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i block = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(block, mask));
+  }
+#elif defined(__ARM_NEON)
+  uint8x16_t mask = vld1q_u8(pattern);
+  for (; i + 16 <= length; i += 16)
+  {
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), mask));
+  }
+#endif
+  uint64_t mask64;
+  memcpy(&mask64, pattern, sizeof(mask64));
+  for (; i + 8 <= length; i += 8)
+  {
+    uint64_t block;
+    memcpy(&block, src + i, sizeof(block));
+    block ^= mask64;
+    memcpy(dst + i, &block, sizeof(block));
+  }
+  // Each full block above is a multiple of four bytes, so the key lines up again here.
+  for (; i < length; ++i)
+  {
+    dst[i] = src[i] ^ key[i % 4];
+  }
+}
+
+/*
+cutil.ws_frame(buffer, position, max) parses the client frame that starts at the position 
+in the buffer. It returns the opcode, whether the FIN bit is set, the unmasked payload, and 
+the position after the frame. It returns nil if the buffer does not hold the whole frame 
+yet, along with the size of the whole frame once its header has arrived, and false, a 
+close status code, and a reason if the frame breaks RFC 6455 or its payload is larger 
+than max.
+*/
+static int ws_frame_error(lua_State *l, int code, const char *reason)
+{
+  lua_pushboolean(l, 0);
+  lua_pushinteger(l, code);
+  lua_pushstring(l, reason);
+  return 3;
+}
+
+static int cutil_ws_frame(lua_State *l)
+{
+  size_t size;
+  const unsigned char *buffer = (const unsigned char*)luaL_checklstring(l, 1, &size);
+  size_t position = luaL_optinteger(l, 2, 1) - 1;
+  lua_Number max = luaL_optnumber(l, 3, 1 << 20);
+  if (position > size || size - position < 2)
+  {
+    lua_pushnil(l);
+    return 1;
+  }
+  const unsigned char *p = buffer + position;
+  size_t available = size - position;
+  int fin = p[0] & 0x80;
+  int opcode = p[0] & 0x0f;
+  if (p[0] & 0x70)
+  {
+    return ws_frame_error(l, 1002, "reserved bits are set");
+  }
+  if (!(p[1] & 0x80))
+  {
+    return ws_frame_error(l, 1002, "client frames must be masked");
+  }
+  if ((opcode > 2 && opcode < 8) || opcode > 10)
+  {
+    return ws_frame_error(l, 1002, "unknown opcode");
+  }
+  uint64_t length = p[1] & 0x7f;
+  size_t header = 2;
+  if (length == 126)
+  {
+    header = 4;
+  }
+  else if (length == 127)
+  {
+    header = 10;
+  }
+  if (available < header + 4)
+  {
+    lua_pushnil(l);
+    return 1;
+  }
+  if (header > 2)
+  {
+    length = 0;
+    for (size_t i = 2; i < header; ++i)
+    {
+      length = length << 8 | p[i];
+    }
+  }
+  if (opcode >= 8 && (!fin || length > 125))
+  {
+    return ws_frame_error(l, 1002, "invalid control frame");
+  }
+  if (length > max)
+  {
+    return ws_frame_error(l, 1009, "message too big");
+  }
+  if (available - header - 4 < length)
+  {
+    lua_pushnil(l);
+    lua_pushnumber(l, (lua_Number)(header + 4 + length));
+    return 2;
+  }
+  const unsigned char *key = p + header;
+  const unsigned char *payload = key + 4;
+  unsigned char *unmasked = lua_newuserdata(l, length ? length : 1);
+  ws_unmask(unmasked, payload, length, key);
+  lua_pushinteger(l, opcode);
+  lua_pushboolean(l, fin);
+  lua_pushlstring(l, (const char*)unmasked, length);
+  lua_pushinteger(l, position + header + 4 + length + 1);
+  return 4;
+}
+
+/*
+cutil.ws_header(opcode, length) returns the header of a final, unmasked server frame with 
+a payload of the given length.
+*/
+static int cutil_ws_header(lua_State *l)
+{
+  int opcode = luaL_checkinteger(l, 1);
+  uint64_t length = luaL_checknumber(l, 2);
+  unsigned char header[10];
+  size_t size = 2;
+  header[0] = 0x80 | (opcode & 0x0f);
+  if (length < 126)
+  {
+    header[1] = length;
+  }
+  else if (length <= 0xffff)
+  {
+    header[1] = 126;
+    header[2] = length >> 8;
+    header[3] = length;
+    size = 4;
+  }
+  else
+  {
+    header[1] = 127;
+    for (int i = 0; i < 8; ++i)
+    {
+      header[9 - i] = length >> (i * 8);
+    }
+    size = 10;
+  }
+  lua_pushlstring(l, (const char*)header, size);
+  return 1;
+}
+
+/*
+cutil.write_available(file, fd, data) writes as much of the data to the socket fd as it 
+takes without blocking, after flushing what the stream has buffered, and returns the number 
+of bytes written. It returns nil and an error message if the connection failed. As in 
+read_available(), the descriptor is nonblocking only during the call.
+*/
+static int cutil_write_available(lua_State *l)
+{
+  luaL_Stream *stream = luaL_checkudata(l, 1, LUA_FILEHANDLE);
+  int fd = luaL_checkinteger(l, 2);
+  size_t length;
+  const char *data = luaL_checklstring(l, 3, &length);
+  if (fflush(stream->f) != 0)
+  {
+    return push_errno(l);
+  }
+  int flags = fcntl(fd, F_GETFL);
+  if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1)
+  {
+    return push_errno(l);
+  }
+  size_t written = 0;
+  int err = 0;
+  while (written < length)
+  {
+    ssize_t count = write(fd, data + written, length - written);
+    if (count < 0)
+    {
+      if (errno != EINTR)
+      {
+        err = errno;
+        break;
+      }
+      continue;
+    }
+    written += count;
+  }
+  fcntl(fd, F_SETFL, flags);
+  if (err && err != EAGAIN && err != EWOULDBLOCK)
+  {
+    lua_pushnil(l);
+    lua_pushstring(l, strerror(err));
+    return 2;
+  }
+  lua_pushinteger(l, written);
+  return 1;
+}
+
+/*
+cutil.utf8_valid(string) returns true if the string is UTF-8 as RFC 3629 defines it, 
+without overlong forms, surrogates, or code points above U+10FFFF. The text messages and 
+close reasons of WebSocket connections must be. Runs of ASCII are checked eight bytes at a 
+time.
+*/
+static int cutil_utf8_valid(lua_State *l)
+{
+  size_t length;
+  const unsigned char *s = (const unsigned char*)luaL_checklstring(l, 1, &length);
+  size_t i = 0;
+  while (i < length)
+  {
+    if (i + 8 <= length)
+    {
+      uint64_t block;
+      memcpy(&block, s + i, sizeof(block));
+      if (!(block & 0x8080808080808080ULL))
+      {
+        i += 8;
+        continue;
+      }
+    }
+    unsigned char c = s[i];
+    if (c < 0x80)
+    {
+      ++i;
+      continue;
+    }
+    // The number of continuation bytes and the range of the first one.
+    size_t count;
+    unsigned char low = 0x80, high = 0xbf;
+    if (c >= 0xc2 && c <= 0xdf)
+    {
+      count = 1;
+    }
+    else if (c >= 0xe0 && c <= 0xef)
+    {
+      count = 2;
+      low = c == 0xe0 ? 0xa0 : 0x80;
+      high = c == 0xed ? 0x9f : 0xbf;
+    }
+    else if (c >= 0xf0 && c <= 0xf4)
+    {
+      count = 3;
+      low = c == 0xf0 ? 0x90 : 0x80;
+      high = c == 0xf4 ? 0x8f : 0xbf;
+    }
+    else
+    {
+      break;
+    }
+    if (length - i - 1 < count || s[i + 1] < low || s[i + 1] > high)
+    {
+      break;
+    }
+    size_t j = 2;
+    while (j <= count && (s[i + j] & 0xc0) == 0x80)
+    {
+      ++j;
+    }
+    if (j <= count)
+    {
+      break;
+    }
+    i += count + 1;
+  }
+  lua_pushboolean(l, i == length);
+  return 1;
+}
+
+/*
+cutil.read_available(file, max, fd) returns up to max bytes of what the client has sent so 
+far without blocking: the bytes left in the buffer of the stream and then whatever the 
+socket holds. It returns an empty string if there is nothing to read, and nil and "EOF" 
+once the client has closed the connection. The descriptor is nonblocking only during the 
+call because the write stream of the request shares it. The socket is given as fd when 
+the stream has no descriptor of its own, as for TLS in user space.
+*/
+static int cutil_read_available(lua_State *l)
+{
+  luaL_Stream *stream = luaL_checkudata(l, 1, LUA_FILEHANDLE);
+  size_t max = luaL_optinteger(l, 2, 65536);
+  FILE *f = stream->f;
+  int fd = fileno(f);
+  if (fd < 0)
+  {
+    fd = luaL_checkinteger(l, 3);
+  }
+  int flags = fcntl(fd, F_GETFL);
+  if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1)
+  {
+    return push_errno(l);
+  }
+  char *p = lua_newuserdata(l, max ? max : 1);
+  size_t count = fread(p, 1, max, f);
+  int err = errno;
+  int eof = feof(f);
+  int error = ferror(f) && err != EAGAIN && err != EWOULDBLOCK;
+  clearerr(f);
+  fcntl(fd, F_SETFL, flags);
+  if (count == 0 && (eof || error))
+  {
+    lua_pushnil(l);
+    lua_pushstring(l, eof ? "EOF" : strerror(err));
+    return 2;
+  }
+  lua_pushlstring(l, p, count);
+  return 1;
+}
+
+#if LUA_VERSION_NUM == 502
+static int dump_writer(lua_State *l, const void *p, size_t size, void *ud)
+{
+  (void)l;
+  luaL_addlstring((luaL_Buffer*)ud, p, size);
+  return 0;
+}
+
+/*
+Like string.dump(func), but Lua 5.2 has no way to leave out the debug information from 
+Lua. With strip set, the bytecode is smaller and loads faster, like the output of luac -s, 
+but errors no longer report line numbers.
+*/
+static int cutil_dump(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TFUNCTION);
+  luaL_argcheck(l, !lua_iscfunction(l, 1), 1, "unable to dump given function");
+  int strip = lua_toboolean(l, 2);
+  lua_settop(l, 1);
+  const LClosure *closure = lua_topointer(l, 1);
+  luaL_Buffer b;
+  luaL_buffinit(l, &b);
+  luaU_dump(l, closure->p, dump_writer, &b, strip);
+  luaL_pushresult(&b);
+  return 1;
+}
+#else
+// LuaJIT's string.dump() takes the strip argument itself.
+static int cutil_dump(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TFUNCTION);
+  int strip = lua_toboolean(l, 2);
+  lua_getglobal(l, "string");
+  lua_getfield(l, -1, "dump");
+  lua_pushvalue(l, 1);
+  lua_pushboolean(l, strip);
+  lua_call(l, 2, 1);
+  return 1;
+}
+
+/*
+LuaJIT only accepts file handles that it created itself, so the ones made by 
+posix.stdio.fdopen() do not work with its io library. Open a file with io.open() and put 
+the stream of the descriptor in its place.
+*/
+static int cutil_fdopen(lua_State *l)
+{
+  int fd = luaL_checkinteger(l, 1);
+  const char *mode = luaL_checkstring(l, 2);
+  lua_getglobal(l, "io");
+  lua_getfield(l, -1, "open");
+  lua_pushliteral(l, "/dev/null");
+  lua_pushstring(l, mode);
+  lua_call(l, 2, 3);
+  if (lua_isnil(l, -3))
+  {
+    return 3;
+  }
+  lua_pop(l, 2);
+  luaL_Stream *stream = luaL_checkudata(l, -1, LUA_FILEHANDLE);
+  FILE *f = fdopen(fd, mode);
+  if (!f)
+  {
+    return push_errno(l);
+  }
+  fclose(stream->f);
+  stream->f = f;
+  return 1;
+}
+#endif
+
+/*
+Return the contents of a regular file that only the effective user can have written: it 
+is owned by that user, is not writable by the group or others, and is not a symbolic link. 
+Return nil and an error message otherwise. The checks are made on the open descriptor so 
+the file cannot be swapped between the checks and the read.
+
+--Example:
+local data, errmsg = cutil.read_private("/var/cache/modserver/servlet.luac")
+*/
+static int cutil_read_private(lua_State *l)
+{
+  const char *path = luaL_checkstring(l, 1);
+  int fd = open(path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+  if (fd == -1)
+  {
+    return push_errno(l);
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+  {
+    int err = errno;
+    close(fd);
+    errno = err;
+    return push_errno(l);
+  }
+  if (!S_ISREG(st.st_mode) || st.st_uid != geteuid() || (st.st_mode & (S_IWGRP | S_IWOTH)))
+  {
+    close(fd);
+    lua_pushnil(l);
+    lua_pushfstring(l, "%s: not a private file", path);
+    return 2;
+  }
+  luaL_Buffer b;
+  luaL_buffinit(l, &b);
+  ssize_t count;
+  do
+  {
+    char *p = luaL_prepbuffer(&b);
+    count = read(fd, p, LUAL_BUFFERSIZE);
+    if (count > 0)
+    {
+      luaL_addsize(&b, count);
+    }
+  } while (count > 0 || (count == -1 && errno == EINTR));
+  int err = errno;
+  close(fd);
+  if (count == -1)
+  {
+    errno = err;
+    return push_errno(l);
+  }
   luaL_pushresult(&b);
   return 1;
 }
 
+/*
+api:rwrite(buffer) for every servlet. The body framing is chosen once when the headers are 
+written and stored in self.response_body as "chunked", "identity" or "none" for HEAD. A 
+write error is remembered in self.response_error so that later writes fail at once instead 
+of raising and catching an error for each write. The output of a deferred request goes 
+through the event loop instead of the stream. Return the number of bytes written, or the 
+error message and errno.
+*/
+static int cutil_rwrite(lua_State *l)
+{
+  luaL_checktype(l, 1, LUA_TTABLE);
+  size_t length;
+  const char *buffer = luaL_checklstring(l, 2, &length);
+  lua_settop(l, 2);
+  lua_getfield(l, 1, "response_error");
+  if (!lua_isnil(l, 3))
+  {
+    return 1;
+  }
+  lua_pop(l, 1);
+  lua_getfield(l, 1, "response_body");
+  if (lua_isnil(l, 3))
+  {
+    lua_pop(l, 1);
+    lua_getfield(l, 1, "write_status_line_and_headers");
+    lua_pushvalue(l, 1);
+    if (lua_pcall(l, 1, 0, 0) != LUA_OK)
+    {
+      lua_pushvalue(l, -1);
+      lua_setfield(l, 1, "response_error");
+      return 1;
+    }
+    lua_getfield(l, 1, "response_body");
+  }
+  const char *body = luaL_checkstring(l, 3);
+  if (body[0] == 'n' || length == 0)
+  {
+    // A zero length chunk would end the response.
+    lua_pushinteger(l, length);
+    return 1;
+  }
+  lua_getfield(l, 1, "deferred");
+  int deferred = lua_toboolean(l, -1);
+  lua_pop(l, 1);
+  if (deferred)
+  {
+    // The event loop queues what a slow client does not take. See api:send_deferred().
+    lua_getfield(l, 1, "send_deferred");
+    lua_pushvalue(l, 1);
+    luaL_Buffer b;
+    luaL_buffinit(l, &b);
+    if (body[0] == 'c')
+    {
+      char size[24];
+      luaL_addlstring(&b, size, snprintf(size, sizeof(size), "%zX\r\n", length));
+      luaL_addlstring(&b, buffer, length);
+      luaL_addlstring(&b, "\r\n", 2);
+    }
+    else
+    {
+      luaL_addlstring(&b, buffer, length);
+    }
+    luaL_pushresult(&b);
+    lua_call(l, 2, 1);
+    if (!lua_toboolean(l, -1))
+    {
+      lua_getfield(l, 1, "response_error");
+      return 1;
+    }
+    lua_pushinteger(l, length);
+    return 1;
+  }
+  lua_getfield(l, 1, "clientfd_write");
+  luaL_Stream *stream = luaL_checkudata(l, -1, LUA_FILEHANDLE);
+  FILE *f = stream->f;
+  int ok;
+  if (body[0] == 'c')
+  {
+    char size[24];
+    int size_length = snprintf(size, sizeof(size), "%zX\r\n", length);
+    ok = fwrite(size, 1, size_length, f) == (size_t)size_length
+      && fwrite(buffer, 1, length, f) == length
+      && fwrite("\r\n", 1, 2, f) == 2;
+  }
+  else
+  {
+    ok = fwrite(buffer, 1, length, f) == length;
+  }
+  if (!ok)
+  {
+    int err = errno;
+    lua_pushstring(l, strerror(err));
+    lua_pushvalue(l, -1);
+    lua_setfield(l, 1, "response_error");
+    lua_pushinteger(l, err);
+    return 2;
+  }
+  lua_pushinteger(l, length);
+  return 1;
+}
+
+/*
+Start a program directly rather than through /bin/sh like io.popen() does. posix_spawn() 
+may use vfork() semantics, which avoids copying the page tables of a large child process 
+only to call exec.
+
+The program starts with SIGPIPE set to the default action because the server ignores it.
+
+On Linux, the optional death_signal is sent to the program when the process that started 
+it exits, even by a crash, so that a program that outlives a request is not left behind. 
+Such a program is started with fork() because posix_spawn() cannot ask for the signal.
+
+--Example:
+local pid = cutil.spawn("./hello.cgi", {"./hello.cgi"}, {"NAME=value"}, stdin_fd, stdout_fd)
+*/
+#ifdef __linux__
+static pid_t spawn_tied(const char *path, const char **argv, const char **envp,
+  int stdin_fd, int stdout_fd, int death_signal)
+{
+  // The child reports a failed exec through the pipe, which exec closes otherwise.
+  int report[2];
+  if (pipe(report) == -1)
+  {
+    return -1;
+  }
+  fcntl(report[1], F_SETFD, FD_CLOEXEC);
+  pid_t parent = getpid();
+  pid_t pid = fork();
+  if (pid == 0)
+  {
+    close(report[0]);
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigprocmask(SIG_SETMASK, &mask, NULL);
+    signal(SIGPIPE, SIG_DFL);
+    // The parent may have exited before the signal was asked for.
+    if (prctl(PR_SET_PDEATHSIG, death_signal) == -1 || getppid() != parent
+      || (stdin_fd != STDIN_FILENO && dup2(stdin_fd, STDIN_FILENO) == -1)
+      || (stdout_fd != STDOUT_FILENO && dup2(stdout_fd, STDOUT_FILENO) == -1))
+    {
+      _exit(127);
+    }
+    execve(path, (char *const*)argv, (char *const*)envp);
+    int err = errno;
+    ssize_t ignored = write(report[1], &err, sizeof(err));
+    (void)ignored;
+    _exit(127);
+  }
+  int err = errno;
+  close(report[1]);
+  if (pid > 0)
+  {
+    ssize_t count;
+    do
+    {
+      count = read(report[0], &err, sizeof(err));
+    } while (count == -1 && errno == EINTR);
+    if (count == sizeof(err))
+    {
+      waitpid(pid, NULL, 0);
+      pid = -1;
+    }
+  }
+  close(report[0]);
+  errno = err;
+  return pid;
+}
+#endif
+
+static int cutil_spawn(lua_State *l)
+{
+  const char *path = luaL_checkstring(l, 1);
+  luaL_checktype(l, 2, LUA_TTABLE);
+  luaL_checktype(l, 3, LUA_TTABLE);
+  int stdin_fd = luaL_checkinteger(l, 4);
+  int stdout_fd = luaL_checkinteger(l, 5);
+  int death_signal = luaL_optinteger(l, 6, 0);
+  // The strings are kept alive by the tables for the duration of the call.
+  size_t argc = lua_rawlen(l, 2);
+  size_t envc = lua_rawlen(l, 3);
+  const char **argv = lua_newuserdata(l, (argc + 1) * sizeof(char*));
+  const char **envp = lua_newuserdata(l, (envc + 1) * sizeof(char*));
+  for (size_t i = 0; i < argc; ++i)
+  {
+    lua_rawgeti(l, 2, i + 1);
+    argv[i] = luaL_checkstring(l, -1);
+    lua_pop(l, 1);
+  }
+  argv[argc] = NULL;
+  for (size_t i = 0; i < envc; ++i)
+  {
+    lua_rawgeti(l, 3, i + 1);
+    envp[i] = luaL_checkstring(l, -1);
+    lua_pop(l, 1);
+  }
+  envp[envc] = NULL;
+#ifdef __linux__
+  if (death_signal)
+  {
+    pid_t pid = spawn_tied(path, argv, envp, stdin_fd, stdout_fd, death_signal);
+    if (pid == -1)
+    {
+      return push_errno(l);
+    }
+    lua_pushnumber(l, pid);
+    return 1;
+  }
+#else
+  (void)death_signal;
+#endif
+  
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  if (stdin_fd != STDIN_FILENO)
+  {
+    posix_spawn_file_actions_adddup2(&actions, stdin_fd, STDIN_FILENO);
+  }
+  if (stdout_fd != STDOUT_FILENO)
+  {
+    posix_spawn_file_actions_adddup2(&actions, stdout_fd, STDOUT_FILENO);
+  }
+  posix_spawnattr_t attr;
+  posix_spawnattr_init(&attr);
+  sigset_t default_signals, mask;
+  sigemptyset(&default_signals);
+  sigaddset(&default_signals, SIGPIPE);
+  sigemptyset(&mask);
+  posix_spawnattr_setsigdefault(&attr, &default_signals);
+  posix_spawnattr_setsigmask(&attr, &mask);
+  posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK);
+  pid_t pid;
+  int err = posix_spawn(&pid, path, &actions, &attr, (char *const*)argv, 
+    (char *const*)envp);
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+  if (err != 0)
+  {
+    errno = err;
+    return push_errno(l);
+  }
+  lua_pushnumber(l, pid);
+  return 1;
+}
+
+#ifdef __linux__
+/*
+inotify lets the parent sleep until a servlet changes instead of calling stat() on every 
+servlet each time around the loop. The Lua side falls back to stat() polling on other 
+platforms where these functions are absent.
+*/
+static int cutil_inotify_init(lua_State *l)
+{
+  int fd = inotify_init();
+  if (fd == -1)
+  {
+    return push_errno(l);
+  }
+  fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC);
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  lua_pushnumber(l, fd);
+  return 1;
+}
+
+/*
+Watch a directory rather than the servlet itself. Editors often save by writing a new 
+file and renaming it over the old one, which would silently end a watch on the old file.
+IN_CLOSE_WRITE waits for the writer to close the file so a half-written servlet is 
+never loaded.
+*/
+static int cutil_inotify_add_watch(lua_State *l)
+{
+  int fd = luaL_checknumber(l, 1);
+  const char *path = luaL_checkstring(l, 2);
+  int wd = inotify_add_watch(fd, path, IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd == -1)
+  {
+    return push_errno(l);
+  }
+  lua_pushnumber(l, wd);
+  return 1;
+}
+
+/*
+Return an array of {wd = watch descriptor, name = file name} for each pending event, or 
+an empty array if there are none.
+*/
+static int cutil_inotify_read(lua_State *l)
+{
+  int fd = luaL_checknumber(l, 1);
+  char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  lua_newtable(l);
+  int count = 0;
+  while (1)
+  {
+    ssize_t len = read(fd, buf, sizeof(buf));
+    if (len <= 0)
+    {
+      if (len == -1 && errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    for (char *p = buf; p < buf + len; )
+    {
+      const struct inotify_event *event = (const struct inotify_event*)p;
+      if (event->len > 0)
+      {
+        lua_createtable(l, 0, 2);
+        lua_pushnumber(l, event->wd);
+        lua_setfield(l, -2, "wd");
+        lua_pushstring(l, event->name);
+        lua_setfield(l, -2, "name");
+        lua_rawseti(l, -2, ++count);
+      }
+      p += sizeof(struct inotify_event) + event->len;
+    }
+  }
+  return 1;
+}
+#endif
+
 static const luaL_Reg cutil[] = 
 {
+  {"base64", cutil_base64},
+  {"broadcast", cutil_broadcast},
+  {"dump", cutil_dump},
+#if LUA_VERSION_NUM == 501
+  {"fdopen", cutil_fdopen},
+#endif
   {"fgets", cutil_fgets},
+  {"maxrss", cutil_maxrss},
+  {"now", cutil_now},
+  {"read_available", cutil_read_available},
+  {"read_private", cutil_read_private},
+  {"rwrite", cutil_rwrite},
+  {"sha1", cutil_sha1},
+  {"shared_counters", cutil_shared_counters},
+  {"spawn", cutil_spawn},
+  {"utf8_valid", cutil_utf8_valid},
+  {"write_available", cutil_write_available},
+  {"ws_frame", cutil_ws_frame},
+  {"ws_header", cutil_ws_header},
+#ifdef __linux__
+  {"inotify_init", cutil_inotify_init},
+  {"inotify_add_watch", cutil_inotify_add_watch},
+  {"inotify_read", cutil_inotify_read},
+#endif
   {NULL, NULL},
 };
 
 LUALIB_API int luaopen_cutil(lua_State *l)
 {
+  luaL_newmetatable(l, SHARED_COUNTERS);
+  luaL_newlib(l, shared_counters_methods);
+  lua_setfield(l, -2, "__index");
+  lua_pop(l, 1);
+  luaL_newmetatable(l, BROADCAST);
+  luaL_newlib(l, broadcast_methods);
+  lua_setfield(l, -2, "__index");
+  lua_pop(l, 1);
   luaL_newlib(l, cutil);
   return 1;
 }
@@ -4,17 +4,33 @@ local cutil = require("cutil")
 local errno = require("posix.errno")
 local fcntl = require("posix.fcntl")
 local signal = require("posix.signal")
+local stdio = require("posix.stdio")
+
+-- LuaJIT has the bit library instead of bit32.
+local bit = bit32 or require("bit")
 
 function util.set_nonblocking(fd)
   local current_flags = assert(fcntl.fcntl(fd, fcntl.F_GETFL))
-  assert(fcntl.fcntl(fd, fcntl.F_SETFL, bit32.bor(current_flags, fcntl.O_NONBLOCK)))
+  assert(fcntl.fcntl(fd, fcntl.F_SETFL, bit.bor(current_flags, fcntl.O_NONBLOCK)))
 end
 
 function util.set_close_on_exec(fd)
   local current_flags = assert(fcntl.fcntl(fd, fcntl.F_GETFD))
-  assert(fcntl.fcntl(fd, fcntl.F_SETFD, bit32.bor(current_flags, fcntl.FD_CLOEXEC)))
+  assert(fcntl.fcntl(fd, fcntl.F_SETFD, bit.bor(current_flags, fcntl.FD_CLOEXEC)))
+end
+
+function util.clear_close_on_exec(fd)
+  local current_flags = assert(fcntl.fcntl(fd, fcntl.F_GETFD))
+  local flags = bit.band(current_flags, bit.bnot(fcntl.FD_CLOEXEC))
+  assert(fcntl.fcntl(fd, fcntl.F_SETFD, flags))
 end
 
+--[[
+Return a Lua file for the descriptor. cutil.fdopen() exists when built with LuaJIT, which 
+does not accept the files made by posix.stdio.fdopen().
+--]]
+util.fdopen = cutil.fdopen or stdio.fdopen
+
 function util.fgets(length, file)
   while true do
     local buffer, errmsg, errnum = cutil.fgets(length, file)
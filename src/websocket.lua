@@ -0,0 +1,442 @@
+--[[
+WebSocket connections as RFC 6455 describes them. ws_upgrade() answers the handshake with
+101 Switching Protocols and defers the request to the event loop of the child, so one
+child holds any number of open connections and an idle connection costs a file descriptor
+rather than a process. The child reads from a connection only when poll() reports it as
+readable and calls the on_message callback of the servlet once for each whole message.
+
+The frames are parsed and unmasked in C. See util.c.
+--]]
+local websocket = {}
+
+local config = require("config")
+local cutil = require("cutil")
+local event = require("event")
+local http = require("http")
+local stdio = require("posix.stdio")
+
+local GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+local CONTINUATION, TEXT, BINARY, CLOSE, PING, PONG = 0, 1, 2, 8, 9, 10
+
+-- Read at most this many bytes from a connection on each turn of the event loop.
+local READ_SIZE = 64 * 1024
+
+-- Return the Sec-WebSocket-Accept value for a Sec-WebSocket-Key value.
+function websocket.accept_key(key)
+  return cutil.base64(cutil.sha1(key .. GUID))
+end
+
+-- Return true if the comma separated header value holds the token, ignoring case.
+local function has_token(value, token)
+  for item in tostring(value or ""):gmatch("[^,%s]+") do
+    if item:lower() == token then
+      return true
+    end
+  end
+  return false
+end
+
+--[[
+Send one frame through the event loop, which queues what the socket does not take so that
+a slow client does not hold up the child. A failed write is remembered in response_error
+like a failed rwrite() so that the connection is finished by the next read.
+--]]
+local function write_frame(state, opcode, payload)
+  return event.send(state, cutil.ws_header(opcode, #payload) .. payload)
+end
+
+-- Pass a message to the servlet. The message is nil once the connection has closed.
+local function deliver(state, message, kind)
+  local ws = state.ws
+  ws.message, ws.kind = message, kind
+  if ws.on_message then
+    ws.on_message(state, message, kind)
+  end
+  ws.message, ws.kind = nil, nil
+end
+
+-- Pass a whole message to the servlet, or close with 1007 if a text message is not UTF-8.
+local function deliver_message(state, message, kind)
+  if kind == "text" and not cutil.utf8_valid(message) then
+    websocket.close(state, 1007, "invalid UTF-8")
+  else
+    deliver(state, message, kind)
+  end
+end
+
+function websocket.send(state, message, kind)
+  local ws = state.ws
+  if not ws or ws.closed then
+    return false
+  end
+  message = tostring(message)
+  return write_frame(state, kind == "binary" and BINARY or TEXT, message)
+end
+
+--[[
+Send a close frame with the status code and reason, tell the servlet, and close the
+connection. The server closes the TCP connection first as RFC 6455 recommends.
+--]]
+function websocket.close(state, code, reason)
+  local ws = state.ws
+  if not ws or ws.closed then
+    return
+  end
+  ws.closed = true
+  local payload = ""
+  if code then
+    payload = string.char(math.floor(code / 256) % 256, code % 256) .. (reason or "")
+  end
+  write_frame(state, CLOSE, payload:sub(1, 125))
+  deliver(state, nil)
+  state:finish()
+end
+
+local function handle_frame(state, opcode, fin, payload)
+  local ws = state.ws
+  ws.alive = true
+  if opcode == PING then
+    write_frame(state, PONG, payload)
+  elseif opcode == PONG then
+    return
+  elseif opcode == CLOSE then
+    local code
+    if #payload >= 2 then
+      code = payload:byte(1) * 256 + payload:byte(2)
+    end
+    if #payload == 1 then
+      websocket.close(state, 1002, "invalid close frame")
+    elseif not cutil.utf8_valid(payload:sub(3)) then
+      websocket.close(state, 1007, "invalid UTF-8")
+    else
+      websocket.close(state, code)
+    end
+  elseif opcode == CONTINUATION then
+    if not ws.fragments then
+      websocket.close(state, 1002, "unexpected continuation frame")
+    else
+      table.insert(ws.fragments, payload)
+      ws.fragments_size = ws.fragments_size + #payload
+      if fin then
+        local message, kind = table.concat(ws.fragments), ws.fragments_kind
+        ws.fragments = nil
+        deliver_message(state, message, kind)
+      end
+    end
+  elseif ws.fragments then
+    websocket.close(state, 1002, "expected a continuation frame")
+  else
+    local kind = opcode == BINARY and "binary" or "text"
+    if fin then
+      deliver_message(state, payload, kind)
+    else
+      ws.fragments, ws.fragments_size, ws.fragments_kind = {payload}, #payload, kind
+    end
+  end
+end
+
+--[[
+Parse the whole frames in the buffer, keep the rest for the next read, and return false if
+the connection was closed.
+--]]
+local function parse(state)
+  local ws = state.ws
+  local position = 1
+  while not ws.closed do
+    local limit = config.cfg.websocket_max_message
+    if ws.fragments then
+      limit = limit - ws.fragments_size
+    end
+    local opcode, fin, payload, next_position = cutil.ws_frame(ws.buffer, position, limit)
+    if opcode == nil then
+      -- fin is the size of the whole frame once its header has arrived.
+      ws.needed = fin or 0
+      break
+    elseif opcode == false then
+      -- fin and payload are the status code and the reason.
+      websocket.close(state, fin, payload)
+    else
+      position = next_position
+      handle_frame(state, opcode, fin, payload)
+    end
+  end
+  if position > 1 then
+    ws.buffer = ws.buffer:sub(position)
+  end
+  return not ws.closed
+end
+
+--[[
+Read what the client has sent without blocking. A full read may have left more in the
+buffer of the stream where poll() cannot see it, so the next read happens on the next turn
+of the loop rather than when the descriptor becomes readable.
+
+The reads of a large frame are collected in a list and joined once the whole frame has
+arrived, rather than appended to the buffer one by one, which would copy the frame once
+for each read.
+--]]
+local function receive(state)
+  local ws = state.ws
+  local data = cutil.read_available(state.clientfd_read, READ_SIZE, ws.fd)
+  if not data or state.response_error then
+    ws.closed = true
+    deliver(state, nil)
+    state:finish()
+    return
+  end
+  if #data > 0 then
+    table.insert(ws.pending, data)
+    ws.pending_size = ws.pending_size + #data
+    if #ws.buffer + ws.pending_size >= ws.needed then
+      ws.buffer = ws.buffer .. table.concat(ws.pending)
+      ws.pending, ws.pending_size = {}, 0
+      if not parse(state) then
+        return
+      end
+    end
+  end
+  if state.finished then
+    -- The servlet finished the request from on_message.
+    return
+  elseif #data == READ_SIZE then
+    event.resume(state, receive)
+  else
+    event.watch(state, ws.fd, receive)
+  end
+end
+
+local function ping(state)
+  local interval = config.cfg.websocket_ping
+  if interval > 0 then
+    event.timer(state, interval * 1000, function(self)
+      local ws = self.ws
+      if ws.closed then
+        return
+      end
+      if not ws.alive then
+        -- The client did not answer the last ping or send anything since.
+        ws.closed = true
+        deliver(self, nil)
+        self:finish()
+        return
+      end
+      ws.alive = false
+      if write_frame(self, PING, "") then
+        ping(self)
+      end
+    end)
+  end
+end
+
+--[[
+Answer the handshake and turn the request into a WebSocket connection. Return the state,
+or nil and an error message after writing an error response if the request is not a valid
+handshake. Headers the servlet set before, such as Sec-WebSocket-Protocol, are sent with
+the 101 response.
+--]]
+function websocket.upgrade(state)
+  if state.ws then
+    return state
+  end
+  if state.h2 then
+    -- The extended CONNECT of RFC 8441 is not supported, and HTTP/2 has no 101 response.
+    state:set_status(501)
+    state:rwrite("501 Not Implemented: WebSocket over HTTP/2")
+    return nil, "WebSocket over HTTP/2 is not supported"
+  end
+  local headers = state.request.headers
+  local key = headers["sec-websocket-key"]
+  if state:get_method() ~= "GET" or not has_token(headers["upgrade"], "websocket")
+    or not has_token(headers["connection"], "upgrade") or not key or #key ~= 24 then
+    state:set_status(400)
+    state:rwrite("400 Bad Request: not a WebSocket handshake")
+    return nil, "not a WebSocket handshake"
+  end
+  if headers["sec-websocket-version"] ~= "13" then
+    state:set_status(426)
+    state:set_header("Sec-WebSocket-Version", "13")
+    state:rwrite("426 Upgrade Required")
+    return nil, "unsupported WebSocket version"
+  end
+  if state.response_headers_written then
+    return nil, "the response has already started"
+  end
+  local file = state.clientfd_write
+  state:set_header("Upgrade", "websocket")
+  state:set_header("Connection", "Upgrade")
+  state:set_header("Sec-WebSocket-Accept", websocket.accept_key(key))
+  http.write_status_line(file, 101)
+  http.write_headers(file, state.response_headers)
+  assert(file:write("\r\n"))
+  assert(file:flush())
+  state.status = 101
+  state.response_headers_written = true
+  state.response_body = "none"
+  state.ws = {
+    -- The stream of a TLS connection in user space has no descriptor.
+    fd = state.tls and state.tls.fd or stdio.fileno(state.clientfd_read),
+    buffer = "",
+    -- Reads not yet joined to the buffer, and the size the buffer needs for the next frame.
+    pending = {},
+    pending_size = 0,
+    needed = 0,
+    alive = true,
+  }
+  state:defer()
+  -- The ping finds the clients that have left instead.
+  state.deferred_timeout = 0
+  -- The client may have sent frames right after the handshake.
+  event.resume(state, receive)
+  ping(state)
+  return state
+end
+
+--[[
+Call callback(state, message, kind) for each message, and with a nil message once the
+connection closes.
+--]]
+function websocket.on_message(state, callback)
+  assert(state.ws, "ws_upgrade() was not called")
+  state.ws.on_message = callback
+end
+
+-- Return the message being delivered to on_message and its kind, or nil after the close.
+function websocket.recv(state)
+  local ws = state.ws
+  if ws then
+    return ws.message, ws.kind
+  end
+end
+
+-- Tests below this line:
+------------------------------------------------------------------------------------------
+
+if os.getenv("TEST") == "1" then
+  local function hex(data)
+    return (data:gsub(".", function(c) return ("%02x"):format(c:byte()) end))
+  end
+  assert(hex(cutil.sha1("")) == "da39a3ee5e6b4b0d3255bfef95601890afd80709")
+  assert(hex(cutil.sha1("abc")) == "a9993e364706816aba3e25717850c26c9cd0d89d")
+  assert(hex(cutil.sha1(("a"):rep(1000))) == "291e9a6c66994949b57ba5e650361e98fc36b1ba")
+  assert(cutil.base64("") == "" and cutil.base64("f") == "Zg==")
+  assert(cutil.base64("fo") == "Zm8=" and cutil.base64("foobar") == "Zm9vYmFy")
+  -- The example of RFC 6455 section 1.3.
+  local accept = websocket.accept_key("dGhlIHNhbXBsZSBub25jZQ==")
+  assert(accept == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=")
+
+  -- Mask a frame the way a client does.
+  local function client_frame(first, payload, key)
+    local length = #payload
+    local header
+    if length < 126 then
+      header = string.char(first, 0x80 + length)
+    elseif length < 65536 then
+      header = string.char(first, 0x80 + 126, math.floor(length / 256), length % 256)
+    else
+      header = string.char(first, 0x80 + 127, 0, 0, 0, 0,
+        math.floor(length / 16777216) % 256, math.floor(length / 65536) % 256,
+        math.floor(length / 256) % 256, length % 256)
+    end
+    local masked = {}
+    for i = 1, length do
+      local a, b = payload:byte(i), key:byte((i - 1) % 4 + 1)
+      -- XOR without bit32 so that the test runs on Lua 5.1 too.
+      local x, bit = 0, 1
+      while a > 0 or b > 0 do
+        if a % 2 ~= b % 2 then
+          x = x + bit
+        end
+        a, b, bit = math.floor(a / 2), math.floor(b / 2), bit * 2
+      end
+      masked[i] = string.char(x)
+    end
+    return header .. key .. table.concat(masked)
+  end
+
+  -- Payload lengths around the SIMD, eight byte, and single byte paths of the unmasking.
+  for _, length in ipairs{0, 1, 7, 8, 15, 16, 17, 33, 125, 126, 1000, 65536} do
+    local payload = {}
+    for i = 1, length do
+      payload[i] = string.char((i * 7) % 256)
+    end
+    payload = table.concat(payload)
+    local frame = client_frame(0x82, payload, "\1\127\128\255")
+    local opcode, fin, unmasked, next_position = cutil.ws_frame("xx" .. frame, 3)
+    assert(opcode == BINARY and fin and unmasked == payload)
+    assert(next_position == #frame + 3)
+    local incomplete, needed = cutil.ws_frame(frame:sub(1, -2))
+    assert(incomplete == nil and (needed == #frame or #frame - 1 < 6))
+  end
+  do
+    local ok, code = cutil.ws_frame(client_frame(0x81, "hello", "abcd"), 1, 4)
+    assert(ok == false and code == 1009)
+    ok, code = cutil.ws_frame("\129\5hello")
+    assert(ok == false and code == 1002)
+    ok, code = cutil.ws_frame(client_frame(0x09, "", "abcd"))
+    assert(ok == false and code == 1002)
+    ok, code = cutil.ws_frame(client_frame(0xC1, "", "abcd"))
+    assert(ok == false and code == 1002)
+  end
+  for _, text in ipairs{"", "hello", "h\195\169llo w\195\182rld", "\226\130\172",
+    "\240\159\152\128", "\244\143\191\191", ("ascii"):rep(10) .. "\195\169"} do
+    assert(cutil.utf8_valid(text), text)
+  end
+  for _, text in ipairs{"\128", "\192\175", "\195", "\224\128\175", "\237\160\128",
+    "\244\144\128\128", "\255", ("ascii"):rep(10) .. "\195("} do
+    assert(not cutil.utf8_valid(text), text)
+  end
+  assert(cutil.ws_header(TEXT, 5) == "\129\5")
+  assert(cutil.ws_header(BINARY, 300) == "\130\126\1\44")
+  assert(cutil.ws_header(BINARY, 65536) == "\130\127\0\0\0\0\0\1\0\0")
+
+  do
+    -- Reassemble a fragmented message with a ping in between.
+    local written = {}
+    local file = {
+      write = function(_, ...) table.insert(written, table.concat{...}) return true end,
+      flush = function() return true end,
+    }
+    local state = {clientfd_write = file, ws = {buffer = "", alive = true}}
+    state.finish = function(self) self.finished = true end
+    local messages = {}
+    websocket.on_message(state, function(self, message, kind)
+      assert(websocket.recv(self) == message)
+      table.insert(messages, message and kind .. ":" .. message or "closed")
+    end)
+    state.ws.buffer = client_frame(0x01, "hel", "abcd") .. client_frame(0x89, "p", "abcd")
+      .. client_frame(0x80, "lo", "dcba") .. client_frame(0x81, "x", "abcd")
+      .. client_frame(0x88, "\3\232", "abcd"):sub(1, -2)
+    assert(parse(state))
+    assert(table.concat(messages, " ") == "text:hello text:x")
+    assert(written[1] == "\138\1p")
+    state.ws.buffer = state.ws.buffer .. client_frame(0x88, "\3\232", "abcd"):sub(-1)
+    assert(not parse(state))
+    assert(messages[3] == "closed" and written[2] == "\136\2\3\232" and state.finished)
+    assert(not websocket.send(state, "late"))
+
+    -- A text message that is not UTF-8 closes the connection with 1007.
+    state.finished, written = false, {}
+    state.ws = {buffer = client_frame(0x81, "\192\175", "abcd"), alive = true}
+    assert(not parse(state))
+    assert(written[1]:sub(1, 4) == "\136\15\3\239" and state.finished)
+  end
+
+  do
+    -- A stream of an HTTP/2 connection gets an error response instead of a 101.
+    local written = {}
+    local state = {
+      h2 = {},
+      request = {method = "GET", headers = {upgrade = "websocket", connection = "Upgrade",
+        ["sec-websocket-key"] = "dGhlIHNhbXBsZSBub25jZQ==", ["sec-websocket-version"] = "13"}},
+      set_status = function(self, status) self.status = status end,
+      rwrite = function(self, data) table.insert(written, data) end,
+    }
+    assert(websocket.upgrade(state) == nil and state.status == 501 and not state.ws)
+    assert(written[1]:find("^501 "))
+  end
+
+  print("websocket.lua test complete")
+end
+
+return websocket